@@ -0,0 +1,2965 @@
+//----------------------------------------------------------------------------
+//	File:		CDLLBenchmark.cpp
+//
+//	Functions:	main()
+//				nsPerOp()
+//				pushPopCycle()
+//				benchSentinel()
+//				benchUnrolled()
+//				producerConsumer()
+//				benchConcurrent()
+//				benchSPSC()
+//				benchBatch()
+//				makeItem()
+//				keyOf()
+//				sumAll()
+//				lookupAll()
+//				clearAll()
+//				measureOps()
+//				measureQueue()
+//				suiteFor()
+//				benchSuite()
+//				benchAssign()
+//				benchRelease()
+//				queueCycle()
+//				benchDispatch()
+//				walkSum()
+//				benchIterators()
+//				benchParallel()
+//				sortRow()
+//				benchSort()
+//				benchIndex()
+//				zipfKeys()
+//				cacheRun()
+//				benchCache()
+//				rotateRow()
+//				benchRotate()
+//				benchScheduler()
+//				fibSequential()
+//				fibTask()
+//				benchWorkStealing()
+//				holdNs()
+//				benchPriority()
+//				blockingRun()
+//				wakeLatency()
+//				benchBlocking()
+//				pollNs()
+//				benchPolling()
+//----------------------------------------------------------------------------
+// The suite times operator[] with the finger and skip index turned on.
+#define DL_CDLL_INDEX_CACHE 1
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "CircDoubLinkList.h"
+#include "CDLL_Queue.h"
+#include "CDLL_ConcurrentQueue.h"
+#include "CDLL_SPSCQueue.h"
+#include "CDLL_PoolAllocator.h"
+#include "CDLL_SentinelList.h"
+#include "CDLL_UnrolledList.h"
+#include "CDLL_Parallel.h"
+#include "CDLL_IndexedList.h"
+#include "CDLL_Cache.h"
+#include "CDLL_Scheduler.h"
+#include "CDLL_WorkStealing.h"
+#include "CDLL_PriorityQueue.h"
+#include "CDLL_BlockingQueue.h"
+using namespace DL_CDLL;
+
+void benchSentinel();
+void benchUnrolled();
+void benchConcurrent();
+void benchSPSC();
+void benchBatch();
+void benchSuite();
+void benchAssign();
+void benchRelease();
+void benchDispatch();
+void benchIterators();
+void benchParallel();
+void benchSort();
+void benchIndex();
+void benchCache();
+void benchRotate();
+void benchScheduler();
+void benchWorkStealing();
+void benchPriority();
+void benchBlocking();
+void benchPolling();
+
+// Bytes currently handed out through every CountingAllocator.
+size_t countedBytes = 0;
+
+// An allocator that keeps countedBytes up to date so a benchmark can report
+// how much memory a container asked for.
+template<class T>
+struct CountingAllocator
+{
+	typedef T value_type;
+	CountingAllocator() {}
+	template<class U> CountingAllocator(const CountingAllocator<U>&) {}
+	T* allocate(size_t n)
+	{
+		countedBytes += n * sizeof(T);
+		return static_cast<T*>(::operator new(n * sizeof(T)));
+	}
+	void deallocate(T* p, size_t n)
+	{
+		countedBytes -= n * sizeof(T);
+		::operator delete(p);
+	}
+	template<class U>
+	bool operator==(const CountingAllocator<U>&) const { return true; }
+	template<class U>
+	bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+// Keeps the optimizer from throwing the benchmarked work away.
+volatile long long benchSink = 0;
+
+// The large element type of the suite: 256 bytes, copied field by field.
+struct Payload
+{
+	int key;
+	char bytes[252];
+	Payload(int k = 0) : key(k) { memset(bytes, k & 0xff, sizeof(bytes)); }
+};
+
+// ns per element (or per lookup) of each operation the suite times.
+struct opTimes
+{
+	double pushBack, popFront, pushFront, popBack, iterate, index, copy,
+		assign, release;
+};
+
+// The LRU cache benchCache compares against: std::list in order of use and
+// an unordered_map from each key to its list node.
+struct stdLRU
+{
+	list<pair<int, int> > order;
+	unordered_map<int, list<pair<int, int> >::iterator> index;
+	size_t cap;
+	unsigned long long hitCount;
+	explicit stdLRU(size_t capacity) : cap(capacity), hitCount(0)
+		{ index.reserve(capacity); }
+	bool get(int key, int& value)
+	{
+		auto found = index.find(key);
+		if (found == index.end())
+			return false;
+		order.splice(order.begin(), order, found->second);
+		value = found->second->second;
+		hitCount++;
+		return true;
+	}
+	void put(int key, int value)
+	{
+		order.emplace_front(key, value);
+		index[key] = order.begin();
+		if (order.size() > cap)
+		{
+			index.erase(order.back().first);
+			order.pop_back();
+		}
+	}
+	unsigned long long hits() const { return hitCount; }
+};
+
+// The thread pool benchWorkStealing compares against: one List of tasks
+// behind one mutex, which every worker pushes to and pops from.
+class ListPool
+{
+public:
+	explicit ListPool(unsigned threads) : pending(0), stopping(false)
+	{
+		for (unsigned i = 0; i < threads; i++)
+			workers.emplace_back([this]() { work(); });
+	}
+	~ListPool()
+	{
+		wait();
+		{
+			lock_guard<mutex> lock(m);
+			stopping = true;
+		}
+		ready.notify_all();
+		for (thread& t : workers)
+			t.join();
+	}
+	template<class Task>
+	void submit(Task t)
+	{
+		lock_guard<mutex> lock(m);
+		pending++;
+		tasks.push_back(new function<void()>(std::move(t)));
+		ready.notify_one();
+	}
+	void wait()
+	{
+		unique_lock<mutex> lock(m);
+		done.wait(lock, [this]() { return pending == 0; });
+	}
+private:
+	void work()
+	{
+		unique_lock<mutex> lock(m);
+		for (;;)
+		{
+			ready.wait(lock, [this]() { return stopping || !tasks.empty(); });
+			if (tasks.empty())
+				return;
+			function<void()>* t = tasks.pop_back();
+			lock.unlock();
+			(*t)();
+			delete t;
+			lock.lock();
+			if (--pending == 0)
+				done.notify_all();
+		}
+	}
+
+	List<function<void()>*> tasks;
+	vector<thread> workers;
+	long pending;
+	bool stopping;
+	mutex m;
+	condition_variable ready, done;
+};
+
+//----------------------------------------------------------------------------
+//	Function:		nsPerOp
+//
+//	Description:	Times a piece of work and reports the average cost of
+//						one operation.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		Work work- The work to time.  It is run once.
+//					size_t ops- The number of operations work performs.
+//
+//	Returns:		The average number of nanoseconds per operation.
+//
+//	Calls:			work()
+//
+//	Called by:		The bench functions
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Work>
+double nsPerOp(Work work, size_t ops)
+{
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	work();
+	chrono::steady_clock::time_point stop = chrono::steady_clock::now();
+	return chrono::duration<double, nano>(stop - start).count() / ops;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		main
+//
+//	Description:	Runs every benchmark, or only the ones named on the
+//						command line.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		int argc- The number of command line arguments.
+//					char* argv[]- The names of the benchmarks to run.
+//
+//	Returns:		EXIT_SUCCESS
+//
+//	Calls:			The bench functions
+//
+//	Called by:		None
+//
+//	Input:			None
+//
+//	Output:			Benchmark results.
+//----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+	struct benchmark { const char* name; void (*run)(); };
+	const benchmark benchmarks[] =
+	{
+		{ "sentinel", benchSentinel },
+		{ "unrolled", benchUnrolled },
+		{ "concurrent", benchConcurrent },
+		{ "spsc", benchSPSC },
+		{ "batch", benchBatch },
+		{ "suite", benchSuite },
+		{ "assign", benchAssign },
+		{ "release", benchRelease },
+		{ "dispatch", benchDispatch },
+		{ "iterators", benchIterators },
+		{ "parallel", benchParallel },
+		{ "sort", benchSort },
+		{ "index", benchIndex },
+		{ "cache", benchCache },
+		{ "rotate", benchRotate },
+		{ "scheduler", benchScheduler },
+		{ "stealing", benchWorkStealing },
+		{ "priority", benchPriority },
+		{ "blocking", benchBlocking },
+		{ "polling", benchPolling },
+	};
+	for (const benchmark& b : benchmarks)
+	{
+		bool selected = argc < 2;
+		for (int i = 1; i < argc; i++)
+			if (strcmp(argv[i], b.name) == 0)
+				selected = true;
+		if (selected)
+			b.run();
+	}
+	return EXIT_SUCCESS;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		pushPopCycle
+//
+//	Description:	The push/pop workload shared by List and SentinelList:
+//						pushes n items at the back and pops them from the
+//						front, then pushes n at the front and pops them from
+//						the back.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		ListType& list- The list to work on.
+//					int n- The number of items per pass.
+//
+//	Returns:		A checksum of the popped values.
+//
+//	Calls:			push_back(), pop_front(), push_front(), pop_back()
+//
+//	Called by:		benchSentinel
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class ListType>
+long long pushPopCycle(ListType& list, int n)
+{
+	long long sum = 0;
+	for (int i = 0; i < n; i++)
+		list.push_back(i);
+	for (int i = 0; i < n; i++)
+		sum += list.pop_front();
+	for (int i = 0; i < n; i++)
+		list.push_front(i);
+	for (int i = 0; i < n; i++)
+		sum += list.pop_back();
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchSentinel
+//
+//	Description:	Compares the per-operation cost of push and pop at both
+//						ends for List and SentinelList on the same workload.
+//						Each pass starts from an empty list, so every push
+//						and pop in List goes through its empty-list checks.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), pushPopCycle()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per push or pop for each list.
+//----------------------------------------------------------------------------
+void benchSentinel()
+{
+	const int passes = 200, n = 5000;
+	const size_t ops = static_cast<size_t>(passes) * n * 4;
+	List<int> list;
+	SentinelList<int> sentinelList;
+	double listNs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+			benchSink += pushPopCycle(list, n);
+	}, ops);
+	double sentinelNs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+			benchSink += pushPopCycle(sentinelList, n);
+	}, ops);
+	cout << "Sentinel layout: push/pop at both ends, " << ops << " ops"
+		<< endl;
+	cout << "\tList:         " << listNs << " ns/op" << endl;
+	cout << "\tSentinelList: " << sentinelNs << " ns/op" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchUnrolled
+//
+//	Description:	Compares List and UnrolledList holding the same ints:
+//						the bytes each asks its allocator for per element,
+//						and the cost per element of walking the whole list
+//						with an iterator.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), push_back(), begin()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			Bytes per element and ns per element for each list.
+//----------------------------------------------------------------------------
+void benchUnrolled()
+{
+	const int n = 1000000, passes = 20;
+	const size_t ops = static_cast<size_t>(passes) * n;
+	List<int, CountingAllocator<int> > list;
+	for (int i = 0; i < n; i++)
+		list.push_back(i);
+	double listBytes = static_cast<double>(countedBytes) / n;
+	UnrolledList<int, 32, CountingAllocator<int> > unrolled;
+	for (int i = 0; i < n; i++)
+		unrolled.push_back(i);
+	double unrolledBytes = static_cast<double>(countedBytes) / n - listBytes;
+
+	double listNs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+		{
+			List<int, CountingAllocator<int> >::iterator it = list.begin();
+			long long sum = 0;
+			for (int i = 0; i < n; i++, ++it)
+				sum += *it;
+			benchSink += sum;
+		}
+	}, ops);
+	double unrolledNs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+		{
+			UnrolledList<int, 32, CountingAllocator<int> >::iterator it =
+				unrolled.begin();
+			long long sum = 0;
+			for (int i = 0; i < n; i++, ++it)
+				sum += *it;
+			benchSink += sum;
+		}
+	}, ops);
+	cout << "Unrolled layout: " << n << " ints, 32 per chunk" << endl;
+	cout << "\tList:         " << listBytes << " bytes/element, "
+		<< listNs << " ns/element to iterate" << endl;
+	cout << "\tUnrolledList: " << unrolledBytes << " bytes/element, "
+		<< unrolledNs << " ns/element to iterate" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		producerConsumer
+//
+//	Description:	Runs producer threads that each push n items and
+//						consumer threads that pop until every item has been
+//						taken.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		Push push- Pushes one int.
+//					TryPop tryPop- Pops one int into its argument, returning
+//						false if there was nothing to pop.
+//					int producers, consumers- The number of each thread.
+//					int n- The number of items each producer pushes.
+//
+//	Returns:		None
+//
+//	Calls:			push(), tryPop()
+//
+//	Called by:		benchConcurrent, benchSPSC, benchBlocking
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Push, class TryPop>
+void producerConsumer(Push push, TryPop tryPop, int producers, int consumers,
+	int n)
+{
+	atomic<int> remaining(producers * n);
+	vector<thread> threads;
+	for (int p = 0; p < producers; p++)
+		threads.push_back(thread([&]()
+		{
+			for (int i = 0; i < n; i++)
+				push(i);
+		}));
+	for (int c = 0; c < consumers; c++)
+		threads.push_back(thread([&]()
+		{
+			long long sum = 0;
+			int item;
+			while (remaining.load(memory_order_relaxed) > 0)
+				if (tryPop(item))
+				{
+					sum += item;
+					remaining.fetch_sub(1, memory_order_relaxed);
+				}
+			benchSink += sum;
+		}));
+	for (thread& t : threads)
+		t.join();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchConcurrent
+//
+//	Description:	Compares a Queue guarded by one mutex with a
+//						ConcurrentQueue, with two producer and two consumer
+//						threads sharing the queue.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), producerConsumer()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per item for each queue.
+//----------------------------------------------------------------------------
+void benchConcurrent()
+{
+	const int producers = 2, consumers = 2, n = 500000;
+	const size_t ops = static_cast<size_t>(producers) * n;
+	Queue<int> queue;
+	mutex queueLock;
+	double lockedNs = nsPerOp([&]()
+	{
+		producerConsumer([&](int i)
+		{
+			lock_guard<mutex> lock(queueLock);
+			queue.push(i);
+		}, [&](int& item)
+		{
+			lock_guard<mutex> lock(queueLock);
+			if (queue.empty())
+				return false;
+			item = queue.pop();
+			return true;
+		}, producers, consumers, n);
+	}, ops);
+	ConcurrentQueue<int> concurrent;
+	double concurrentNs = nsPerOp([&]()
+	{
+		producerConsumer([&](int i) { concurrent.push(i); },
+			[&](int& item) { return concurrent.try_pop(item); },
+			producers, consumers, n);
+	}, ops);
+	cout << "Concurrent queue: " << producers << " producers, " << consumers
+		<< " consumers, " << ops << " items" << endl;
+	cout << "\tQueue + mutex:   " << lockedNs << " ns/item" << endl;
+	cout << "\tConcurrentQueue: " << concurrentNs << " ns/item" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchSPSC
+//
+//	Description:	Compares a Queue guarded by one mutex with an
+//						SPSCQueue, with one producer and one consumer
+//						thread.  Either side yields when the other has to
+//						catch up.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), producerConsumer()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per item for each queue.
+//----------------------------------------------------------------------------
+void benchSPSC()
+{
+	const int n = 2000000;
+	Queue<int> queue;
+	mutex queueLock;
+	double lockedNs = nsPerOp([&]()
+	{
+		producerConsumer([&](int i)
+		{
+			lock_guard<mutex> lock(queueLock);
+			queue.push(i);
+		}, [&](int& item)
+		{
+			{
+				lock_guard<mutex> lock(queueLock);
+				if (!queue.empty())
+				{
+					item = queue.pop();
+					return true;
+				}
+			}
+			this_thread::yield();
+			return false;
+		}, 1, 1, n);
+	}, n);
+	SPSCQueue<int> ring(1024);
+	double ringNs = nsPerOp([&]()
+	{
+		producerConsumer([&](int i)
+		{
+			while (!ring.try_push(i))
+				this_thread::yield();
+		}, [&](int& item)
+		{
+			if (ring.try_pop(item))
+				return true;
+			this_thread::yield();
+			return false;
+		}, 1, 1, n);
+	}, n);
+	cout << "SPSC queue: 1 producer, 1 consumer, " << n << " items" << endl;
+	cout << "\tQueue + mutex:       " << lockedNs << " ns/item" << endl;
+	cout << "\tSPSCQueue (1024):    " << ringNs << " ns/item" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchBatch
+//
+//	Description:	Passes batches of 256 ints through a Queue, once with
+//						push and pop on every item and once with push_range
+//						and pop_n on the whole batch.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), push(), pop(), push_range(), pop_n()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per item for each way of passing the batch.
+//----------------------------------------------------------------------------
+void benchBatch()
+{
+	const int batch = 256, passes = 20000;
+	const size_t ops = static_cast<size_t>(passes) * batch;
+	vector<int> in(batch), out(batch);
+	for (int i = 0; i < batch; i++)
+		in[i] = i;
+	Queue<int> queue;
+	double singleNs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+		{
+			for (int i = 0; i < batch; i++)
+				queue.push(in[i]);
+			for (int i = 0; i < batch; i++)
+				out[i] = queue.pop();
+			benchSink += out[batch - 1];
+		}
+	}, ops);
+	double batchNs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+		{
+			queue.push_range(in.begin(), in.end());
+			queue.pop_n(out.begin(), batch);
+			benchSink += out[batch - 1];
+		}
+	}, ops);
+	cout << "Batch transfer: " << passes << " batches of " << batch <<
+		" ints through a Queue" << endl;
+	cout << "\tpush/pop:          " << singleNs << " ns/item" << endl;
+	cout << "\tpush_range/pop_n:  " << batchNs << " ns/item" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		makeItem
+//
+//	Description:	Makes the i-th element of a suite container.  Strings
+//						are long enough to live on the heap.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		int i- The element number.
+//
+//	Returns:		The element.
+//
+//	Calls:			None
+//
+//	Called by:		measureOps, measureQueue
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class T> T makeItem(int i) { return T(i); }
+template<> string makeItem<string>(int i)
+{
+	return "suite element number " + to_string(i);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		keyOf
+//
+//	Description:	Reduces a suite element to a number so that reading it
+//						cannot be optimized away.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		The element.
+//
+//	Returns:		A number taken from the element.
+//
+//	Calls:			None
+//
+//	Called by:		sumAll, lookupAll, measureOps, measureQueue
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+long long keyOf(int item) { return item; }
+long long keyOf(const string& item) { return item.size(); }
+long long keyOf(const Payload& item) { return item.key; }
+
+//----------------------------------------------------------------------------
+//	Function:		sumAll
+//
+//	Description:	Walks a whole container once.  List's iterator wraps
+//						around, so it is walked getSize() steps.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		The container.
+//
+//	Returns:		The sum of keyOf() over the elements.
+//
+//	Calls:			keyOf()
+//
+//	Called by:		measureOps
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class T, class Alloc, class Dispatch>
+long long sumAll(const List<T, Alloc, Dispatch>& c)
+{
+	long long sum = 0;
+	typename List<T, Alloc, Dispatch>::iterator it = c.begin();
+	for (unsigned i = 0; i < c.getSize(); i++, ++it)
+		sum += keyOf(*it);
+	return sum;
+}
+template<class Container>
+long long sumAll(const Container& c)
+{
+	long long sum = 0;
+	for (typename Container::const_iterator it = c.begin(); it != c.end();
+		++it)
+		sum += keyOf(*it);
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		lookupAll
+//
+//	Description:	Reads the given indices through operator[].  std::list
+//						has no operator[], which is reported as -1.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		The container.
+//					const vector<int>& indices- The indices to read.
+//
+//	Returns:		The sum of keyOf() over the elements read, or -1.
+//
+//	Calls:			operator[], keyOf()
+//
+//	Called by:		measureOps
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Container>
+long long lookupAll(const Container& c, const vector<int>& indices)
+{
+	long long sum = 0;
+	for (size_t i = 0; i < indices.size(); i++)
+		sum += keyOf(c[indices[i]]);
+	return sum;
+}
+template<class T>
+long long lookupAll(const list<T>&, const vector<int>&)
+{
+	return -1;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		clearAll
+//
+//	Description:	Empties a container: release() for List, clear() for
+//						the standard containers.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		The container.
+//
+//	Returns:		None
+//
+//	Calls:			release() or clear()
+//
+//	Called by:		measureOps
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class T, class Alloc, class Dispatch>
+void clearAll(List<T, Alloc, Dispatch>& c) { c.release(); }
+template<class Container>
+void clearAll(Container& c) { c.clear(); }
+
+//----------------------------------------------------------------------------
+//	Function:		measureOps
+//
+//	Description:	Times every suite operation on one kind of container
+//						holding n elements, repeating the whole round reps
+//						times.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		int n- The number of elements.
+//					int reps- The number of rounds.
+//					const vector<int>& indices- The indices operator[]
+//						reads each round.
+//
+//	Returns:		The average ns per element of each operation, and per
+//						lookup for operator[] (-1 if there is none).
+//
+//	Calls:			nsPerOp(), makeItem(), sumAll(), lookupAll(),
+//					clearAll()
+//
+//	Called by:		suiteFor
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Container, class T>
+opTimes measureOps(int n, int reps, const vector<int>& indices)
+{
+	opTimes t = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	bool indexed = true;
+	for (int r = 0; r < reps; r++)
+	{
+		Container c;
+		t.pushBack += nsPerOp([&]()
+		{
+			for (int i = 0; i < n; i++)
+				c.push_back(makeItem<T>(i));
+		}, 1);
+		t.popFront += nsPerOp([&]()
+		{
+			for (int i = 0; i < n; i++)
+				c.pop_front();
+		}, 1);
+		t.pushFront += nsPerOp([&]()
+		{
+			for (int i = 0; i < n; i++)
+				c.push_front(makeItem<T>(i));
+		}, 1);
+		t.popBack += nsPerOp([&]()
+		{
+			for (int i = 0; i < n; i++)
+				c.pop_back();
+		}, 1);
+		for (int i = 0; i < n; i++)
+			c.push_back(makeItem<T>(i));
+		t.iterate += nsPerOp([&]() { benchSink += sumAll(c); }, 1);
+		t.index += nsPerOp([&]()
+		{
+			long long sum = lookupAll(c, indices);
+			indexed = sum >= 0;
+			benchSink += sum;
+		}, 1);
+		{
+			unique_ptr<Container> copy;
+			t.copy += nsPerOp([&]() { copy.reset(new Container(c)); }, 1);
+		}
+		Container other;
+		t.assign += nsPerOp([&]() { other = c; }, 1);
+		t.release += nsPerOp([&]() { clearAll(other); }, 1);
+	}
+	double elements = static_cast<double>(n) * reps;
+	t.pushBack /= elements;
+	t.popFront /= elements;
+	t.pushFront /= elements;
+	t.popBack /= elements;
+	t.iterate /= elements;
+	t.index = indexed ? t.index / (static_cast<double>(indices.size()) *
+		reps) : -1;
+	t.copy /= elements;
+	t.assign /= elements;
+	t.release /= elements;
+	return t;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		measureQueue
+//
+//	Description:	Times pushing n elements through a queue and popping
+//						them back out, repeated reps times.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		Push push- Pushes one element.
+//					Pop pop- Pops one element and returns its keyOf().
+//					int n- The number of elements.
+//					int reps- The number of rounds.
+//
+//	Returns:		The average ns per element pushed and popped.
+//
+//	Calls:			nsPerOp(), push(), pop()
+//
+//	Called by:		suiteFor
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Push, class Pop>
+double measureQueue(Push push, Pop pop, int n, int reps)
+{
+	return nsPerOp([&]()
+	{
+		for (int r = 0; r < reps; r++)
+		{
+			for (int i = 0; i < n; i++)
+				push(i);
+			long long sum = 0;
+			for (int i = 0; i < n; i++)
+				sum += pop();
+			benchSink += sum;
+		}
+	}, static_cast<size_t>(n) * reps);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		suiteFor
+//
+//	Description:	Runs the suite for one element type at each size,
+//						comparing List with std::list and std::deque, and
+//						Queue with std::queue over std::deque and std::list.
+//						Small sizes are repeated until each round covers
+//						about a million elements.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		const char* typeName- The name of T to print.
+//					const vector<int>& sizes- The element counts to run.
+//
+//	Returns:		None
+//
+//	Calls:			measureOps(), measureQueue(), makeItem(), keyOf()
+//
+//	Called by:		benchSuite
+//
+//	Input:			None
+//
+//	Output:			A table of ns per element for each size.
+//----------------------------------------------------------------------------
+template<class T>
+void suiteFor(const char* typeName, const vector<int>& sizes)
+{
+	for (size_t s = 0; s < sizes.size(); s++)
+	{
+		int n = sizes[s];
+		int reps = n >= 1000000 ? 1 : 1000000 / n;
+		vector<int> indices;
+		unsigned seed = 12345;
+		for (int i = 0; i < (n < 1000 ? n : 1000); i++)
+		{
+			seed = seed * 1103515245 + 12345;
+			indices.push_back(static_cast<int>((seed >> 8) % n));
+		}
+		opTimes times[3] =
+		{
+			measureOps<List<T>, T>(n, reps, indices),
+			measureOps<list<T>, T>(n, reps, indices),
+			measureOps<deque<T>, T>(n, reps, indices),
+		};
+		Queue<T> cdllQueue;
+		queue<T> dequeQueue;
+		queue<T, list<T> > listQueue;
+		double queueNs[3] =
+		{
+			measureQueue([&](int i) { cdllQueue.push(makeItem<T>(i)); },
+				[&]() { return keyOf(cdllQueue.pop()); }, n, reps),
+			measureQueue([&](int i) { listQueue.push(makeItem<T>(i)); },
+				[&]()
+				{
+					long long key = keyOf(listQueue.front());
+					listQueue.pop();
+					return key;
+				}, n, reps),
+			measureQueue([&](int i) { dequeQueue.push(makeItem<T>(i)); },
+				[&]()
+				{
+					long long key = keyOf(dequeQueue.front());
+					dequeQueue.pop();
+					return key;
+				}, n, reps),
+		};
+
+		struct row { const char* name; double opTimes::*field; };
+		const row rows[] =
+		{
+			{ "push_back", &opTimes::pushBack },
+			{ "pop_front", &opTimes::popFront },
+			{ "push_front", &opTimes::pushFront },
+			{ "pop_back", &opTimes::popBack },
+			{ "iterate", &opTimes::iterate },
+			{ "operator[]", &opTimes::index },
+			{ "copy", &opTimes::copy },
+			{ "operator=", &opTimes::assign },
+			{ "release", &opTimes::release },
+		};
+		cout << typeName << ", " << n << " elements (ns/element)" << endl;
+		cout << "\t" << left << setw(14) << "" << right << setw(12) << "List"
+			<< setw(12) << "std::list" << setw(12) << "std::deque" << endl;
+		cout << fixed << setprecision(2);
+		for (const row& r : rows)
+		{
+			cout << "\t" << left << setw(14) << r.name << right;
+			for (int c = 0; c < 3; c++)
+			{
+				double ns = times[c].*r.field;
+				if (ns < 0)
+					cout << setw(12) << "-";
+				else
+					cout << setw(12) << ns;
+			}
+			cout << endl;
+		}
+		cout << "\t" << left << setw(14) << "queue push+pop" << right;
+		for (int c = 0; c < 3; c++)
+			cout << setw(12) << queueNs[c];
+		cout << endl << defaultfloat;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchSuite
+//
+//	Description:	Runs the full operation suite for int, string and
+//						256-byte Payload elements from 10 elements up.  The
+//						largest size is 10M for int; string and Payload stop
+//						at 1M and 100K to keep the containers in memory.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			suiteFor()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			The suite's tables.
+//----------------------------------------------------------------------------
+void benchSuite()
+{
+	vector<int> sizes;
+	sizes.push_back(10);
+	sizes.push_back(1000);
+	sizes.push_back(100000);
+	vector<int> payloadSizes(sizes);
+	sizes.push_back(1000000);
+	vector<int> stringSizes(sizes);
+	sizes.push_back(10000000);
+	suiteFor<int>("int", sizes);
+	suiteFor<string>("string", stringSizes);
+	suiteFor<Payload>("Payload (256 bytes)", payloadSizes);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchAssign
+//
+//	Description:	Times copy assignment of a 1M-element List<int>: the
+//						old element-by-element rebuild (release() and then
+//						push_back() per element), operator= into an empty
+//						list, operator= into a list of the same size whose
+//						nodes are reused, and operator= into an empty list
+//						on a PoolAllocator, which reserves every node in
+//						one chunk.  The first two cases free the previous
+//						copy inside the timed pass.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), operator=, release(), push_back()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ms per assignment for each case.
+//----------------------------------------------------------------------------
+void benchAssign()
+{
+	const int n = 1000000, passes = 10;
+	List<int> source;
+	List<int, PoolAllocator<int> > poolSource;
+	for (int i = 0; i < n; i++)
+	{
+		source.push_back(i);
+		poolSource.push_back(i);
+	}
+	const double nsPerMs = 1e6;
+	List<int> target;
+	double rebuildMs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+		{
+			target.release();
+			List<int>::iterator it = source.begin();
+			for (int i = 0; i < n; i++, ++it)
+				target.push_back(*it);
+			benchSink += target.back();
+		}
+	}, passes) / nsPerMs;
+	double emptyMs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+		{
+			target.release();
+			target = source;
+			benchSink += target.back();
+		}
+	}, passes) / nsPerMs;
+	double reuseMs = nsPerOp([&]()
+	{
+		for (int p = 0; p < passes; p++)
+		{
+			target = source;
+			benchSink += target.back();
+		}
+	}, passes) / nsPerMs;
+	double poolMs = 0;
+	for (int p = 0; p < passes; p++)
+	{
+		// A fresh pool each time, so every pass has to carve its nodes.
+		List<int, PoolAllocator<int> > poolTarget;
+		poolMs += nsPerOp([&]()
+		{
+			poolTarget = poolSource;
+			benchSink += poolTarget.back();
+		}, 1) / nsPerMs;
+	}
+	poolMs /= passes;
+	cout << "Copy assignment of a " << n << "-element List<int>" << endl;
+	cout << "\trelease + push_back:      " << rebuildMs << " ms" << endl;
+	cout << "\toperator= into empty:     " << emptyMs << " ms" << endl;
+	cout << "\toperator= reusing nodes:  " << reuseMs << " ms" << endl;
+	cout << "\toperator= with a pool:    " << poolMs << " ms" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchRelease
+//
+//	Description:	Times emptying a 10M-element List<int> by popping
+//						every node from the front, with release(), and with
+//						release() on a PoolAllocator, where the nodes go
+//						back to the pool as one chain.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), push_n(), pop_front(), release()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ms to empty the list each way.
+//----------------------------------------------------------------------------
+void benchRelease()
+{
+	const int n = 10000000;
+	const double nsPerMs = 1e6;
+	List<int> list;
+	list.push_n(n, 1);
+	double popMs = nsPerOp([&]()
+	{
+		while (!list.empty())
+			benchSink += list.pop_front();
+	}, 1) / nsPerMs;
+	list.push_n(n, 1);
+	double releaseMs = nsPerOp([&]() { list.release(); }, 1) / nsPerMs;
+	List<int, PoolAllocator<int> > poolList;
+	poolList.push_n(n, 1);
+	double poolMs = nsPerOp([&]() { poolList.release(); }, 1) / nsPerMs;
+	cout << "Emptying a " << n << "-element List<int>" << endl;
+	cout << "\tpop_front per node:   " << popMs << " ms" << endl;
+	cout << "\trelease():            " << releaseMs << " ms" << endl;
+	cout << "\trelease() with pool:  " << poolMs << " ms" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		queueCycle
+//
+//	Description:	The hot loop for benchDispatch: keeps a queue topped up
+//						to depth items, pushing and popping one at a time and
+//						checking getSize() and empty() on every pass.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		QueueType& queue- The queue to work on.
+//					int n- The number of push/pop pairs.
+//					unsigned depth- The number of items kept queued.
+//
+//	Returns:		A checksum of the popped values.
+//
+//	Calls:			getSize(), empty(), push(), pop()
+//
+//	Called by:		benchDispatch
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class QueueType>
+long long queueCycle(QueueType& queue, int n, unsigned depth)
+{
+	long long sum = 0;
+	for (int i = 0; i < n; i++)
+	{
+		while (queue.getSize() < depth)
+			queue.push(i);
+		if (!queue.empty())
+			sum += queue.pop();
+	}
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchDispatch
+//
+//	Description:	Compares Queue<int> with DynamicDispatch (the default)
+//						and StaticDispatch, both on a PoolAllocator so that
+//						node allocation does not hide the cost of the calls,
+//						and reports each object's size.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), queueCycle()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per push/pop pair and bytes per object.
+//----------------------------------------------------------------------------
+void benchDispatch()
+{
+	const int n = 10000000;
+	const unsigned depth = 64;
+	typedef Queue<int, PoolAllocator<int>, DynamicDispatch> dynamicQueue;
+	typedef Queue<int, PoolAllocator<int>, StaticDispatch> staticQueue;
+	dynamicQueue dynamicQ;
+	staticQueue staticQ;
+	queueCycle(dynamicQ, n / 10, depth); // warms up both pools
+	queueCycle(staticQ, n / 10, depth);
+	double dynamicNs = nsPerOp([&]()
+		{ benchSink += queueCycle(dynamicQ, n, depth); }, n);
+	double staticNs = nsPerOp([&]()
+		{ benchSink += queueCycle(staticQ, n, depth); }, n);
+	cout << "Queue<int> push/pop with getSize() and empty() checks, "
+		<< depth << " deep (ns per pair)" << endl;
+	cout << "\tDynamicDispatch:  " << dynamicNs << "\t("
+		<< sizeof(dynamicQueue) << " bytes)" << endl;
+	cout << "\tStaticDispatch:   " << staticNs << "\t("
+		<< sizeof(staticQueue) << " bytes)" << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		walkSum
+//
+//	Description:	Sums a List by walking an Iterator once around it.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		const List<int>& list- The list to walk.
+//
+//	Returns:		The sum of the elements.
+//
+//	Calls:			begin(), getSize()
+//
+//	Called by:		benchIterators
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Iterator>
+long long walkSum(const List<int>& list)
+{
+	long long sum = 0;
+	Iterator it(list.begin());
+	for (unsigned i = list.getSize(); i > 0; i--)
+		sum += *it++;
+	return sum;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchIterators
+//
+//	Description:	Times a full traversal of a 10M-element List<int> with
+//						checked and unchecked iterators, and with a
+//						range-for over range().
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), walkSum(), range()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per element each way.
+//----------------------------------------------------------------------------
+void benchIterators()
+{
+	const int n = 10000000;
+	const int reps = 5;
+	List<int> list;
+	list.push_n(n, 1);
+	double checkedNs = nsPerOp([&]()
+	{
+		for (int r = 0; r < reps; r++)
+			benchSink += walkSum<ListIterator<int, CheckedIterators> >(list);
+	}, size_t(n) * reps);
+	double uncheckedNs = nsPerOp([&]()
+	{
+		for (int r = 0; r < reps; r++)
+			benchSink +=
+				walkSum<ListIterator<int, UncheckedIterators> >(list);
+	}, size_t(n) * reps);
+	double rangeNs = nsPerOp([&]()
+	{
+		for (int r = 0; r < reps; r++)
+		{
+			long long sum = 0;
+			for (int item : list.range())
+				sum += item;
+			benchSink += sum;
+		}
+	}, size_t(n) * reps);
+	cout << "Walking a " << n << "-element List<int> (ns per element)"
+		<< endl;
+	cout << "\tCheckedIterators:    " << checkedNs << endl;
+	cout << "\tUncheckedIterators:  " << uncheckedNs << endl;
+	cout << "\trange-for:           " << rangeNs << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchParallel
+//
+//	Description:	Times parallel_transform and parallel_reduce over a
+//						2M-element List<double> with a CPU-heavy operation,
+//						on 1 thread up to twice the hardware's threads.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), parallel_transform(), parallel_reduce()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per element and the speedup over 1 thread for each
+//						thread count.
+//----------------------------------------------------------------------------
+void benchParallel()
+{
+	const int n = 2000000;
+	unsigned cores = thread::hardware_concurrency();
+	unsigned most = cores > 1 ? 2 * cores : 4;
+	List<double> list;
+	list.push_n(n, 2.0);
+	// Newton's method for the square root, to give each element real work.
+	auto heavy = [](double x)
+	{
+		double root = x;
+		for (int i = 0; i < 20; i++)
+			root = 0.5 * (root + x / root);
+		return root * root;
+	};
+	auto add = [](double a, double b) { return a + b; };
+	cout << "parallel_transform and parallel_reduce over " << n
+		<< " doubles, " << cores << " hardware threads (ns per element)"
+		<< endl;
+	double oneTransform = 0, oneReduce = 0;
+	for (unsigned threads = 1; threads <= most; threads *= 2)
+	{
+		double transformNs = nsPerOp([&]()
+			{ parallel_transform(list, heavy, threads); }, n);
+		double reduceNs = nsPerOp([&]()
+			{ benchSink += (long long)parallel_reduce(list, 0.0, add,
+				threads); }, n);
+		if (threads == 1)
+		{
+			oneTransform = transformNs;
+			oneReduce = reduceNs;
+		}
+		cout << "\t" << setw(2) << threads << " threads:  transform "
+			<< transformNs << " (x" << oneTransform / transformNs
+			<< ")\treduce " << reduceNs << " (x" << oneReduce / reduceNs
+			<< ")" << endl;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		sortRow
+//
+//	Description:	Sorts a pooled List<T> of n pseudo-random values three
+//						ways and prints one row of benchSort's table:
+//						copying into a vector, sorting that and rebuilding
+//						the list; List::sort(); and parallel_sort() on every
+//						hardware thread.  Each list gets a new pool, so
+//						every run starts from the same node layout.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		const char* typeName- The name to print for T.
+//					int n- The number of elements.
+//					Compare comp- The ordering.
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), makeItem(), sort(), parallel_sort(),
+//						push_range(), release()
+//
+//	Called by:		benchSort
+//
+//	Input:			None
+//
+//	Output:			ms for each way.
+//----------------------------------------------------------------------------
+template<class T, class Compare>
+void sortRow(const char* typeName, int n, Compare comp)
+{
+	const double nsPerMs = 1e6;
+	typedef List<T, PoolAllocator<T> > poolList;
+	vector<T> values;
+	values.reserve(n);
+	unsigned seed = 12345;
+	for (int i = 0; i < n; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		values.push_back(makeItem<T>(static_cast<int>(seed >> 8)));
+	}
+	double vectorMs, sortMs, parallelMs;
+	{
+		poolList list;
+		list.push_range(values.begin(), values.end());
+		vectorMs = nsPerOp([&]()
+		{
+			vector<T> copy(list.cbegin(), list.cend());
+			stable_sort(copy.begin(), copy.end(), comp);
+			list.release();
+			list.push_range(copy.begin(), copy.end());
+		}, 1) / nsPerMs;
+	}
+	{
+		poolList list;
+		list.push_range(values.begin(), values.end());
+		sortMs = nsPerOp([&]() { list.sort(comp); }, 1) / nsPerMs;
+	}
+	{
+		poolList list;
+		list.push_range(values.begin(), values.end());
+		parallelMs = nsPerOp([&]() { parallel_sort(list, comp); }, 1)
+			/ nsPerMs;
+	}
+	cout << setw(8) << typeName << setw(12) << n << setw(14) << vectorMs
+		<< setw(14) << sortMs << setw(16) << parallelMs << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchSort
+//
+//	Description:	Times sorting List<int> at 1M, 10M and 100M elements
+//						and List<Payload> at 1M.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			sortRow()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			A table of ms for each way at each size.
+//----------------------------------------------------------------------------
+void benchSort()
+{
+	cout << "Sorting a List of random values (ms), parallel_sort on "
+		<< thread::hardware_concurrency() << " hardware threads" << endl;
+	cout << setw(8) << "type" << setw(12) << "size" << setw(14)
+		<< "via vector" << setw(14) << "List::sort" << setw(16)
+		<< "parallel_sort" << endl;
+	less<int> intLess;
+	auto payloadLess = [](const Payload& a, const Payload& b)
+		{ return a.key < b.key; };
+	sortRow<int>("int", 1000000, intLess);
+	sortRow<int>("int", 10000000, intLess);
+	sortRow<int>("int", 100000000, intLess);
+	sortRow<Payload>("Payload", 1000000, payloadLess);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchIndex
+//
+//	Description:	Times the LRU step, finding an element by value and
+//						moving it to the front, on a List (a linear walk
+//						and a splice) and on an IndexedList (a hash lookup
+//						and move_to_front()), at several sizes.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), find(), splice(), move_to_front()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per lookup-and-move for each list at each size.
+//----------------------------------------------------------------------------
+void benchIndex()
+{
+	const int sizes[] = { 100, 1000, 10000, 100000 };
+	const int walkOps = 2000, indexOps = 1000000;
+	cout << "Find by value and move to front (ns per op)" << endl;
+	cout << setw(10) << "size" << setw(14) << "List walk" << setw(16)
+		<< "IndexedList" << endl;
+	for (int n : sizes)
+	{
+		List<int> list;
+		IndexedList<int> indexed;
+		indexed.reserve(n);
+		for (int i = 0; i < n; i++)
+		{
+			list.push_back(i);
+			indexed.push_back(i);
+		}
+		unsigned seed = 12345;
+		double walkNs = nsPerOp([&]()
+		{
+			for (int i = 0; i < walkOps; i++)
+			{
+				seed = seed * 1103515245 + 12345;
+				int key = static_cast<int>((seed >> 8) % n);
+				List<int>::iterator it = list.begin();
+				while (*it != key)
+					++it;
+				if (it != list.begin())
+					list.splice(list.begin(), list, it);
+				benchSink += list.front();
+			}
+		}, walkOps);
+		seed = 12345;
+		double indexNs = nsPerOp([&]()
+		{
+			for (int i = 0; i < indexOps; i++)
+			{
+				seed = seed * 1103515245 + 12345;
+				int key = static_cast<int>((seed >> 8) % n);
+				indexed.move_to_front(indexed.find(key));
+				benchSink += indexed.front();
+			}
+		}, indexOps);
+		cout << setw(10) << n << setw(14) << walkNs << setw(16) << indexNs
+			<< endl;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		zipfKeys
+//
+//	Description:	Draws a stream of keys from 0 to n - 1 with a zipfian
+//						distribution: key k comes up in proportion to
+//						1 / (k + 1)^s.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		int n- The number of distinct keys.
+//					double s- The skew; larger is more skewed.
+//					int count- The length of the stream.
+//
+//	Returns:		The keys.
+//
+//	Calls:			upper_bound()
+//
+//	Called by:		benchCache
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+vector<int> zipfKeys(int n, double s, int count)
+{
+	vector<double> cdf(n);
+	double total = 0;
+	for (int k = 0; k < n; k++)
+		cdf[k] = total += 1 / pow(k + 1.0, s);
+	vector<int> keys;
+	keys.reserve(count);
+	unsigned seed = 12345;
+	for (int i = 0; i < count; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		double u = (seed >> 8) / double(1 << 24) * total;
+		keys.push_back(static_cast<int>(upper_bound(cdf.begin(), cdf.end(),
+			u) - cdf.begin()));
+	}
+	return keys;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		cacheRun
+//
+//	Description:	Plays a key stream through a cache, putting each key
+//						that misses, and prints the ns per key and the hit
+//						rate.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		Cache& cache- An empty cache.
+//					const vector<int>& keys- The key stream.
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), get(), put(), hits()
+//
+//	Called by:		benchCache
+//
+//	Input:			None
+//
+//	Output:			ns per key and hit percentage.
+//----------------------------------------------------------------------------
+template<class Cache>
+void cacheRun(Cache& cache, const vector<int>& keys)
+{
+	double ns = nsPerOp([&]()
+	{
+		for (int key : keys)
+		{
+			int value;
+			if (cache.get(key, value))
+				benchSink += value;
+			else
+				cache.put(key, key);
+		}
+	}, keys.size());
+	cout << setw(12) << ns << setw(8)
+		<< 100.0 * cache.hits() / keys.size() << "%";
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchCache
+//
+//	Description:	Plays a zipfian stream of 2M keys drawn from 1M through
+//						LRUCache, ClockCache and a std::list LRU at several
+//						capacities and skews.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			zipfKeys(), cacheRun()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per key and hit rate for each cache.
+//----------------------------------------------------------------------------
+void benchCache()
+{
+	const int keySpace = 1000000, streamLength = 2000000;
+	const double skews[] = { 0.8, 0.99 };
+	const size_t capacities[] = { 1000, 10000, 100000 };
+	cout << "Zipfian key stream through each cache (ns per key, hit rate)"
+		<< endl;
+	cout << setw(6) << "skew" << setw(10) << "capacity" << setw(21)
+		<< "LRUCache" << setw(21) << "ClockCache" << setw(21)
+		<< "std::list LRU" << endl;
+	for (double skew : skews)
+	{
+		vector<int> keys = zipfKeys(keySpace, skew, streamLength);
+		for (size_t capacity : capacities)
+		{
+			cout << setw(6) << skew << setw(10) << capacity;
+			{
+				LRUCache<int, int> lru(capacity);
+				cacheRun(lru, keys);
+			}
+			{
+				ClockCache<int, int> clock(capacity);
+				cacheRun(clock, keys);
+			}
+			{
+				stdLRU baseline(capacity);
+				cacheRun(baseline, keys);
+			}
+			cout << endl;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		rotateRow
+//
+//	Description:	Times three ways of taking the next element of a
+//						round-robin List<T> of 1000 elements: pop_front()
+//						then push_back(), rotate(), and a RoundRobinCursor.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		const char* typeName- The name to print for T.
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), makeItem(), keyOf(), pop_front(),
+//						push_back(), rotate(), next()
+//
+//	Called by:		benchRotate
+//
+//	Input:			None
+//
+//	Output:			ns per step for each way.
+//----------------------------------------------------------------------------
+template<class T>
+void rotateRow(const char* typeName)
+{
+	const int n = 1000, steps = 5000000;
+	List<T> list;
+	for (int i = 0; i < n; i++)
+		list.push_back(makeItem<T>(i));
+	double requeueNs = nsPerOp([&]()
+	{
+		for (int i = 0; i < steps; i++)
+		{
+			list.push_back(list.pop_front());
+			benchSink += keyOf(list.back());
+		}
+	}, steps);
+	double rotateNs = nsPerOp([&]()
+	{
+		for (int i = 0; i < steps; i++)
+		{
+			list.rotate();
+			benchSink += keyOf(list.back());
+		}
+	}, steps);
+	RoundRobinCursor<T> cursor(list);
+	double cursorNs = nsPerOp([&]()
+	{
+		for (int i = 0; i < steps; i++)
+			benchSink += keyOf(cursor.next());
+	}, steps);
+	cout << setw(8) << typeName << setw(18) << requeueNs << setw(12)
+		<< rotateNs << setw(12) << cursorNs << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchRotate
+//
+//	Description:	Compares requeueing, rotate() and RoundRobinCursor for
+//						int, string and Payload elements.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			rotateRow()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per round-robin step for each way.
+//----------------------------------------------------------------------------
+void benchRotate()
+{
+	cout << "Round-robin step over 1000 elements (ns per step)" << endl;
+	cout << setw(8) << "type" << setw(18) << "pop+push_back" << setw(12)
+		<< "rotate()" << setw(12) << "cursor" << endl;
+	rotateRow<int>("int");
+	rotateRow<string>("string");
+	rotateRow<Payload>("Payload");
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchScheduler
+//
+//	Description:	Measures RoundRobinScheduler in two ways.  One thread
+//						cycles try_acquire() and release() over items of
+//						weight 1 to 4; each item's share of the turns
+//						should match its share of the weight.  Then
+//						run() spreads 64 equal items over 1, 2 and 4
+//						workers, each turn doing a little arithmetic.
+//						For each worker count it reports the ns per turn,
+//						Jain's fairness index over the items' turn counts
+//						(1 is perfectly fair), and the longest wait, in
+//						us, between two turns of the same item.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), add(), try_acquire(), release(), run()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			The shares, then a row per worker count.
+//----------------------------------------------------------------------------
+void benchScheduler()
+{
+	const int cycles = 1000000;
+	RoundRobinScheduler<int> weighted;
+	for (int i = 0; i < 4; i++)
+		weighted.add(i, i + 1);
+	long long turns[4] = { 0, 0, 0, 0 };
+	double cycleNs = nsPerOp([&]()
+	{
+		RoundRobinScheduler<int>::handle h;
+		for (int i = 0; i < cycles; i++)
+		{
+			weighted.try_acquire(h);
+			turns[RoundRobinScheduler<int>::item(h)]++;
+			weighted.release(h);
+		}
+	}, cycles);
+	cout << "Weighted round-robin, one thread: " << cycleNs
+		<< " ns per acquire and release" << endl;
+	for (int i = 0; i < 4; i++)
+		cout << "\tweight " << i + 1 << ": " << 100.0 * turns[i] / cycles
+			<< "% of turns (" << 10 * (i + 1) << "% expected)" << endl;
+
+	const int items = 64, totalTurns = 400000;
+	cout << "run() over " << items << " equal items" << endl;
+	cout << setw(8) << "workers" << setw(14) << "ns per turn" << setw(12)
+		<< "fairness" << setw(16) << "max wait (us)" << endl;
+	const unsigned workerCounts[] = { 1, 2, 4 };
+	for (unsigned workers : workerCounts)
+	{
+		typedef chrono::steady_clock::time_point time_point;
+		vector<long long> counts(items, 0);
+		vector<time_point> last(items);
+		vector<double> maxWaitUs(items, 0);
+		RoundRobinScheduler<int> scheduler;
+		for (int i = 0; i < items; i++)
+			scheduler.add(i);
+		atomic<int> done(0);
+		time_point start = chrono::steady_clock::now();
+		for (int i = 0; i < items; i++)
+			last[i] = start;
+		double turnNs = nsPerOp([&]()
+		{
+			scheduler.run(workers, [&](int& item)
+			{
+				time_point now = chrono::steady_clock::now();
+				double waitUs = chrono::duration<double, micro>(now -
+					last[item]).count();
+				if (counts[item] > 0 && waitUs > maxWaitUs[item])
+					maxWaitUs[item] = waitUs;
+				unsigned x = item;
+				for (int j = 0; j < 200; j++)
+					x = x * 1103515245 + 12345;
+				benchSink += x;
+				counts[item]++;
+				last[item] = chrono::steady_clock::now();
+				return ++done < totalTurns;
+			});
+		}, totalTurns);
+		double sum = 0, sumSquares = 0, maxWait = 0;
+		for (int i = 0; i < items; i++)
+		{
+			sum += counts[i];
+			sumSquares += double(counts[i]) * counts[i];
+			maxWait = max(maxWait, maxWaitUs[i]);
+		}
+		cout << setw(8) << workers << setw(14) << turnNs << setw(12)
+			<< sum * sum / (items * sumSquares) << setw(16) << maxWait
+			<< endl;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		fibSequential
+//
+//	Description:	Computes the nth Fibonacci number the slow, recursive
+//						way, as the leaf work of fibTask.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		int n- Which Fibonacci number.
+//
+//	Returns:		The nth Fibonacci number.
+//
+//	Calls:			fibSequential()
+//
+//	Called by:		fibTask
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+long long fibSequential(int n)
+{
+	return n < 2 ? n : fibSequential(n - 1) + fibSequential(n - 2);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		fibTask
+//
+//	Description:	The recursive workload: below cutoff, adds the nth
+//						Fibonacci number to sum; otherwise submits tasks
+//						for n - 1 and n - 2 to the pool.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		Pool& pool- The pool to submit to.
+//					int n- Which Fibonacci number.
+//					int cutoff- Where the recursion stops spawning.
+//					atomic<long long>& sum- The running total.
+//
+//	Returns:		None
+//
+//	Calls:			fibSequential(), submit()
+//
+//	Called by:		benchWorkStealing, fibTask
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Pool>
+void fibTask(Pool& pool, int n, int cutoff, atomic<long long>& sum)
+{
+	if (n < cutoff)
+	{
+		sum += fibSequential(n);
+		return;
+	}
+	pool.submit([&pool, n, cutoff, &sum]()
+		{ fibTask(pool, n - 1, cutoff, sum); });
+	pool.submit([&pool, n, cutoff, &sum]()
+		{ fibTask(pool, n - 2, cutoff, sum); });
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchWorkStealing
+//
+//	Description:	Times a recursive, task-spawning computation of
+//						fib(30) on WorkStealingPool and on ListPool (one
+//						mutex-guarded List), with fine and coarse leaves,
+//						on 1, 2 and 4 threads.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), fibTask(), submit(), wait()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ms for each pool, cutoff and thread count.
+//----------------------------------------------------------------------------
+void benchWorkStealing()
+{
+	const int n = 30;
+	const int cutoffs[] = { 8, 16 };
+	const unsigned threadCounts[] = { 1, 2, 4 };
+	const double nsPerMs = 1e6;
+	cout << "Recursive fib(" << n << ") as tasks (ms), "
+		<< thread::hardware_concurrency() << " hardware threads" << endl;
+	cout << setw(8) << "cutoff" << setw(10) << "tasks" << setw(10)
+		<< "threads" << setw(16) << "work stealing" << setw(16)
+		<< "mutex + List" << endl;
+	for (int cutoff : cutoffs)
+	{
+		// fibTask(k) makes one task, plus the tasks of k - 1 and k - 2.
+		vector<long long> tasks(n + 1, 1);
+		for (int k = cutoff; k <= n; k++)
+			tasks[k] = 1 + tasks[k - 1] + tasks[k - 2];
+		for (unsigned threads : threadCounts)
+		{
+			atomic<long long> sum(0);
+			double stealingMs, listMs;
+			{
+				WorkStealingPool pool(threads);
+				stealingMs = nsPerOp([&]()
+				{
+					pool.submit([&]() { fibTask(pool, n, cutoff, sum); });
+					pool.wait();
+				}, 1) / nsPerMs;
+			}
+			{
+				ListPool pool(threads);
+				listMs = nsPerOp([&]()
+				{
+					pool.submit([&]() { fibTask(pool, n, cutoff, sum); });
+					pool.wait();
+				}, 1) / nsPerMs;
+			}
+			benchSink += sum;
+			cout << setw(8) << cutoff << setw(10) << tasks[n] << setw(10)
+				<< threads << setw(16) << stealingMs << setw(16) << listMs
+				<< endl;
+		}
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		holdNs
+//
+//	Description:	Times the hold model on a priority queue: fill it with
+//						n random priorities from 0 to 63, then repeatedly
+//						pop the first element and push a new random one,
+//						so the size stays at n.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		Push push- Adds a priority to the queue.
+//					Pop pop- Removes and returns the first priority.
+//					int n- The size of the queue.
+//					int ops- The number of pop-and-push steps to time.
+//
+//	Returns:		ns per pop-and-push step.
+//
+//	Calls:			nsPerOp(), push, pop
+//
+//	Called by:		benchPriority
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Push, class Pop>
+double holdNs(Push push, Pop pop, int n, int ops)
+{
+	unsigned seed = 12345;
+	for (int i = 0; i < n; i++)
+	{
+		seed = seed * 1103515245 + 12345;
+		push(static_cast<int>((seed >> 8) % 64));
+	}
+	return nsPerOp([&]()
+	{
+		for (int i = 0; i < ops; i++)
+		{
+			seed = seed * 1103515245 + 12345;
+			benchSink += pop();
+			push(static_cast<int>((seed >> 8) % 64));
+		}
+	}, ops);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchPriority
+//
+//	Description:	Runs the hold model over five priority queues: a List
+//						searched for its minimum on each pop,
+//						PriorityQueue as a binary and a 4-ary heap,
+//						std::priority_queue, and BucketQueue with 64
+//						levels, with and without a PoolAllocator.  The
+//						List is only timed up to 1000 elements.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			holdNs(), erase(), push(), pop()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per pop-and-push step for each queue at each size.
+//----------------------------------------------------------------------------
+void benchPriority()
+{
+	const int sizes[] = { 16, 1000, 100000 };
+	const int ops = 2000000, scanLimit = 1000;
+	cout << "Hold model, pop first and push, priorities 0 to 63 (ns per op)"
+		<< endl;
+	cout << setw(8) << "size" << setw(12) << "List scan" << setw(10)
+		<< "2-ary" << setw(10) << "4-ary" << setw(16) << "priority_queue"
+		<< setw(14) << "BucketQueue" << setw(10) << "+ pool" << endl;
+	for (int n : sizes)
+	{
+		cout << setw(8) << n;
+		if (n <= scanLimit)
+		{
+			List<int, allocator<int>, StaticDispatch> list;
+			cout << setw(12) << holdNs(
+				[&](int p) { list.push_back(p); },
+				[&]()
+				{
+					List<int, allocator<int>, StaticDispatch>::iterator
+						it = list.begin(), first = it;
+					for (unsigned i = 1; i < list.getSize(); i++)
+						if (*++it < *first)
+							first = it;
+					int p = *first;
+					list.erase(first);
+					return p;
+				}, n, ops / n * 10);
+		}
+		else
+			cout << setw(12) << "-";
+		PriorityQueue<int, less<int>, 2> binary;
+		PriorityQueue<int, less<int>, 4> quaternary;
+		priority_queue<int, vector<int>, greater<int> > stdQueue;
+		BucketQueue<int> buckets(64);
+		BucketQueue<int, PoolAllocator<int> > pooled(64);
+		cout << setw(10) << holdNs([&](int p) { binary.push(p); },
+			[&]() { return binary.pop(); }, n, ops);
+		cout << setw(10) << holdNs([&](int p) { quaternary.push(p); },
+			[&]() { return quaternary.pop(); }, n, ops);
+		cout << setw(16) << holdNs([&](int p) { stdQueue.push(p); },
+			[&]()
+			{
+				int p = stdQueue.top();
+				stdQueue.pop();
+				return p;
+			}, n, ops);
+		cout << setw(14) << holdNs([&](int p) { buckets.push(p, p); },
+			[&]() { return buckets.pop(); }, n, ops);
+		cout << setw(10) << holdNs([&](int p) { pooled.push(p, p); },
+			[&]() { return pooled.pop(); }, n, ops) << endl;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		blockingRun
+//
+//	Description:	Runs producer threads that each push n items into a
+//						BlockingQueue and as many consumer threads that
+//						sleep in pop_wait(), or pop_batch() when batch is
+//						set, until the producers finish and the queue is
+//						closed and drained.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		unsigned capacity- The queue's bound, or 0.
+//					int pairs- The number of producers, and of consumers.
+//					int n- The number of items each producer pushes.
+//					bool batch- Whether consumers take up to 64 items at
+//						a time.
+//
+//	Returns:		None
+//
+//	Calls:			push(), pop_wait(), pop_batch(), close()
+//
+//	Called by:		benchBlocking
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+void blockingRun(unsigned capacity, int pairs, int n, bool batch)
+{
+	BlockingQueue<int> queue(capacity);
+	vector<thread> producers, consumers;
+	for (int c = 0; c < pairs; c++)
+		consumers.push_back(thread([&]()
+		{
+			long long sum = 0;
+			int items[64];
+			if (batch)
+				for (size_t k; (k = queue.pop_batch(items, 64)) != 0;)
+					for (size_t i = 0; i < k; i++)
+						sum += items[i];
+			else
+				while (queue.pop_wait(items[0]))
+					sum += items[0];
+			benchSink += sum;
+		}));
+	for (int p = 0; p < pairs; p++)
+		producers.push_back(thread([&]()
+		{
+			for (int i = 0; i < n; i++)
+				queue.push(i);
+		}));
+	for (thread& t : producers)
+		t.join();
+	queue.close();
+	for (thread& t : consumers)
+		t.join();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		wakeLatency
+//
+//	Description:	Measures how long a sleeping consumer takes to get an
+//						item.  Each producer pushes the time, then pauses
+//						long enough for the consumers to go back to
+//						sleep; each consumer pops with pop_wait() and
+//						records now minus the time it got.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		int pairs- The number of producers, and of consumers.
+//					int samples- The number of items each producer pushes.
+//
+//	Returns:		Every latency, in us, sorted.
+//
+//	Calls:			push(), pop_wait(), close(), sort()
+//
+//	Called by:		benchBlocking
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+vector<double> wakeLatency(int pairs, int samples)
+{
+	typedef chrono::steady_clock clock;
+	BlockingQueue<clock::time_point> queue;
+	vector<double> latencies;
+	mutex latencyLock;
+	vector<thread> producers, consumers;
+	for (int c = 0; c < pairs; c++)
+		consumers.push_back(thread([&]()
+		{
+			vector<double> mine;
+			clock::time_point sent;
+			while (queue.pop_wait(sent))
+				mine.push_back(chrono::duration<double, micro>(
+					clock::now() - sent).count());
+			lock_guard<mutex> lock(latencyLock);
+			latencies.insert(latencies.end(), mine.begin(), mine.end());
+		}));
+	for (int p = 0; p < pairs; p++)
+		producers.push_back(thread([&]()
+		{
+			for (int i = 0; i < samples; i++)
+			{
+				queue.push(clock::now());
+				this_thread::sleep_for(chrono::microseconds(500));
+			}
+		}));
+	for (thread& t : producers)
+		t.join();
+	queue.close();
+	for (thread& t : consumers)
+		t.join();
+	sort(latencies.begin(), latencies.end());
+	return latencies;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchBlocking
+//
+//	Description:	Compares BlockingQueue with the polling it replaces, a
+//						mutex-guarded Queue whose consumers call pop() and
+//						catch the empty-list runtime_error, at 1, 4 and
+//						16 producer-consumer pairs.  It reports ns per
+//						item for the polling queue, for pop_wait() and
+//						pop_batch() on an unbounded BlockingQueue, and for
+//						pop_wait() with a capacity of 64, then the median
+//						and 99th percentile wakeup latency.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			nsPerOp(), producerConsumer(), blockingRun(),
+//						wakeLatency()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			A row per number of pairs.
+//----------------------------------------------------------------------------
+void benchBlocking()
+{
+	const int pairCounts[] = { 1, 4, 16 };
+	const int items = 400000, samples = 200;
+	cout << "Blocking queue, " << items << " items (ns per item), wakeup "
+		<< "latency (us), " << thread::hardware_concurrency()
+		<< " hardware threads" << endl;
+	cout << setw(6) << "pairs" << setw(14) << "catch + spin" << setw(12)
+		<< "pop_wait" << setw(12) << "pop_batch" << setw(14)
+		<< "capacity 64" << setw(10) << "median" << setw(8) << "p99"
+		<< endl;
+	for (int pairs : pairCounts)
+	{
+		const int n = items / pairs;
+		Queue<int> queue;
+		mutex queueLock;
+		double spinNs = nsPerOp([&]()
+		{
+			producerConsumer([&](int i)
+			{
+				lock_guard<mutex> lock(queueLock);
+				queue.push(i);
+			}, [&](int& item)
+			{
+				lock_guard<mutex> lock(queueLock);
+				try
+				{
+					item = queue.pop();
+					return true;
+				}
+				catch (const runtime_error&)
+				{
+					return false;
+				}
+			}, pairs, pairs, n);
+		}, items);
+		double waitNs = nsPerOp([&]() { blockingRun(0, pairs, n, false); },
+			items);
+		double batchNs = nsPerOp([&]() { blockingRun(0, pairs, n, true); },
+			items);
+		double boundedNs = nsPerOp([&]()
+			{ blockingRun(64, pairs, n, false); }, items);
+		vector<double> latencies = wakeLatency(pairs, samples);
+		cout << setw(6) << pairs << setw(14) << spinNs << setw(12) << waitNs
+			<< setw(12) << batchNs << setw(14) << boundedNs << setw(10)
+			<< latencies[latencies.size() / 2] << setw(8)
+			<< latencies[latencies.size() * 99 / 100] << endl;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		pollNs
+//
+//	Description:	Times a polling loop over a mostly-empty queue: one
+//						item is pushed every period polls, and every poll
+//						tries to pop one.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		Poll poll- Tries to pop from the list into its
+//						argument, returning false if it was empty.
+//					List<int, allocator<int>, StaticDispatch>& list- The
+//						list polled.
+//					int polls- The number of polls to time.
+//					int period- The number of polls per pushed item.
+//
+//	Returns:		ns per poll.
+//
+//	Calls:			nsPerOp(), push_back(), poll
+//
+//	Called by:		benchPolling
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Poll>
+double pollNs(Poll poll, List<int, allocator<int>, StaticDispatch>& list,
+	int polls, int period)
+{
+	return nsPerOp([&]()
+	{
+		long long sum = 0;
+		int item;
+		for (int i = 0; i < polls; i++)
+		{
+			if (i % period == 0)
+				list.push_back(i);
+			if (poll(item))
+				sum += item;
+		}
+		benchSink += sum;
+	}, polls);
+}
+
+//----------------------------------------------------------------------------
+//	Function:		benchPolling
+//
+//	Description:	Compares three ways to poll a mostly-empty List: call
+//						pop_front() and catch the runtime_error, test
+//						empty() before pop_front(), and try_pop_front().
+//						One poll in 1000, 64 and 4 finds an item.  The
+//						exception is only timed over a tenth as many
+//						polls, since each one takes microseconds.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			pollNs(), pop_front(), empty(), try_pop_front()
+//
+//	Called by:		main
+//
+//	Input:			None
+//
+//	Output:			ns per poll for each way at each rate.
+//----------------------------------------------------------------------------
+void benchPolling()
+{
+	const int periods[] = { 1000, 64, 4 };
+	const int polls = 20000000;
+	typedef List<int, allocator<int>, StaticDispatch> list_type;
+	list_type list;
+	cout << "Polling a mostly-empty List (ns per poll)" << endl;
+	cout << setw(14) << "items/poll" << setw(14) << "catch" << setw(14)
+		<< "empty() test" << setw(16) << "try_pop_front" << endl;
+	for (int period : periods)
+	{
+		double catchNs = pollNs([&](int& item)
+		{
+			try
+			{
+				item = list.pop_front();
+				return true;
+			}
+			catch (const runtime_error&)
+			{
+				return false;
+			}
+		}, list, polls / 10, period);
+		double testNs = pollNs([&](int& item)
+		{
+			if (list.empty())
+				return false;
+			item = list.pop_front();
+			return true;
+		}, list, polls, period);
+		double tryNs = pollNs([&](int& item)
+			{ return list.try_pop_front(item); }, list, polls, period);
+		cout << setw(14) << ("1/" + to_string(period)) << setw(14)
+			<< catchNs << setw(14) << testNs << setw(16) << tryNs << endl;
+	}
+}
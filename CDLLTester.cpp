@@ -1,433 +1,2867 @@
-//----------------------------------------------------------------------------
-//	File:		CDLLTester.cpp
-//
-//	Functions:	main()
-//				testCDLL()
-//				testExceptCDLL()
-//				testQueue()
-//----------------------------------------------------------------------------
-#include "CircDoubLinkList.h"
-#include "CDLL_Queue.h"
-using namespace DL_CDLL;
-
-void testCDLL();
-void testQueue();
-void testExceptCDLL();
-
-//----------------------------------------------------------------------------
-//	Function:		main
-//
-//	Description:	Main menu for testing List and Queue class.
-//
-//	Programmer:		David Landry
-//	
-//	Version:		1.0
-//
-//	Date:			5/19/2016
-//
-//	Environment:	Hardware:
-//						Intel Core i7 processor
-//					Software:
-//						PC powered by Windows 10
-//						Compiled using Microsoft Visual Studio Community 2013.
-//
-//	Parameters:		None
-//
-//	Returns:		EXIT_SUCCESS or EXIT_FAILURE
-//
-//	Calls:			testCDLL(), testExceptCDLL(), testQueue()
-//
-//	Called by:		None
-//
-//	Input:			Menu prompt.
-//
-//	Output:			Menu options.
-//----------------------------------------------------------------------------
-int main()
-{
-	//using DL_CDLL::List; // not the same as std::list<class T>
-	unsigned short menuSelection;
-	do
-	{
-		system("CLS");
-		cout << "Select a test." << endl << endl;
-		cout << "\t1. CDLL standard tests.\n";
-		cout << "\t2. CDLL exception tests.\n";
-		cout << "\t3. Queue tests.\n";
-		cout << "\t0. Quit\n";
-		(cin >> menuSelection).get();
-		system("CLS");
-		switch (menuSelection)
-		{
-		case 1:
-			testCDLL();
-			break;
-		case 2:
-			testExceptCDLL();
-			break;
-		case 3:
-			testQueue();
-			break;
-		default:
-			break;
-		}
-	} while (menuSelection > 0);
-	return EXIT_SUCCESS;
-}
-
-//----------------------------------------------------------------------------
-//	Function:		testCDLL
-//
-//	Description:	Test driver for a circular doubly-linked list.
-//
-//	Programmer:		David Landry
-//	
-//	Version:		1.0
-//
-//	Date:			5/19/2016
-//
-//	Environment:	Hardware:
-//						Intel Core i7 processor
-//					Software:
-//						PC powered by Windows 10
-//						Compiled using Microsoft Visual Studio Community 2013.
-//
-//	Parameters:		None
-//
-//	Returns:		None
-//
-//	Calls:			Various methods of the List class
-//
-//	Called by:		main
-//
-//	Input:			Prompts to continue.
-//
-//	Output:			Data from the List class
-//----------------------------------------------------------------------------
-void testCDLL()
-{
-	try
-	{
-		cout << "Constructor Tests" << endl;
-		cout << "=================" << endl;
-		List<char> emptyList;
-		List<int> filledList(4, 5);
-		List<string> stringList(3, "Test string");
-		List<string> strList2(stringList);
-		cout << "emptyList: " << emptyList << "Size: " << emptyList.getSize() 
-			<< endl << endl;
-		cout << "filledList (4 ints, each with value 5): " << filledList << 
-			"Size: " << filledList.getSize() << endl << endl;
-		cout << "stringList (3 strings, each with a test message): " << 
-			stringList << "Size: " << stringList.getSize() << endl << endl;
-		cout << "strList2 (copy of stringList): " << strList2 << "Size: " << 
-			strList2.getSize() << endl << endl;
-		cout << "Press \"Enter\" to continue."; cin.get();
-		system("CLS");
-		cout << "Various tests on fillList and itList" << endl;
-		cout << "====================================" << endl;
-		cout << "emptyList: " << emptyList;
-		for (char fillList = 'A'; fillList <= 'H'; fillList++)
-		{
-			cout << "Pushing " << fillList << " to the front." << endl;
-			emptyList.push_front(fillList);
-		}
-		cout << "emptyList now filled with letters: " << emptyList << "Size: " 
-			<< emptyList.getSize() << endl << endl;
-		List<char>::iterator itStart = emptyList.begin();
-		for (unsigned short i = 0; i < 4; i++)
-			itStart++;
-		List<char>::iterator itEnd = emptyList.end();
-		List<char> itList(itStart, itEnd);
-		cout << "itList (using iterators copying from emptyList): " << itList 
-			<< "Size: " << itList.getSize() << endl << endl;
-		cout << "First character in itList is " << *itList.begin() << endl;
-		cout << "Last character in itList is " << *itList.end() << endl;
-		cout << "Popping the " << emptyList.pop_front() << " from emptyList." 
-			<< endl;
-		cout << "Popping the " << emptyList.pop_front() << " from emptyList." 
-			<< endl;
-		cout << "Popping the " << emptyList.pop_front() << " from emptyList." 
-			<< endl;
-		cout << "emptyList: " << emptyList << "Size: " << emptyList.getSize() 
-			<< endl;
-		cout << "\tFront: " << emptyList.front() << "\tBack: " << 
-			emptyList.back() << endl;
-		cout << "Press \"Enter\" to continue."; cin.get();
-		system("CLS");
-		cout << "Remaining List Tests" << endl;
-		cout << "====================" << endl;
-		for (unsigned short i = 6; i <= 8; i++)
-		{
-			cout << "Pushing " << i << " to the end of filledList." << endl;
-			filledList.push_back(i);
-		}
-		cout << "filledList: " << filledList << "Size: " << 
-			filledList.getSize() << endl << endl;
-		for (unsigned short i = 0; i < 4; i++)
-			cout << "Popping " << filledList.pop_back() << ":\n";
-		cout << "filledList: " << filledList << endl;
-		if (stringList.empty())
-			cout << "stringList is empty.";
-		else
-			cout << "stringList is NOT empty!";
-		cout << endl << "Using release() on stringList:" << endl;
-		stringList.release();
-		cout << "stringList: " << stringList << "Size: " << 
-			stringList.getSize();
-		if (stringList.empty())
-			cout << " stringList is now empty." << endl;
-		else
-			cout << " stringList is NOT empty!" << endl;
-		List<string> SL2;
-		SL2.push_back("this");
-		SL2.push_back("IS");
-		SL2.push_back("a");
-		SL2.push_back("TEST");
-		cout << "New created string list, SL2:" << endl << SL2;
-		cout << "Setting stringList equal to SL2.";
-		stringList = SL2;
-		cout << "stringList:\n" << stringList << "Size: " << 
-			stringList.getSize() << "  Empty? ";
-		if (stringList.empty())
-			cout << "Yes." << endl;
-		else
-			cout << "No." << endl;
-		cout << "stringList[0] should equal \"this\":  " << stringList[0] << 
-			endl;
-		cout << "stringList[-1] should equal \"TEST\":  " << stringList[-1] <<
-			endl;
-		cout << "Changing stringList[1]..." << endl;
-		stringList[1] = "BE";
-		cout << "stringList:" << stringList;
-		cout << "Press \"Enter\" to continue."; cin.get();
-		system("CLS");
-		cout << "Iteration and Circularity Testing" << endl;
-		cout << "=================================" << endl;
-		cout << "Using itList for testing: " << itList;
-		List<char>::iterator it2 = itList.begin();
-		cout << "How many iterator hops would you like to test? ";
-		int trials = 0;
-		(cin >> trials).get();
-		
-		for (int i = 0; i < trials; i++)
-		{
-			cout << "Iterator: " << it2 << "\tValue: " << *it2;
-			if (it2 == itList.begin())
-				cout << "\tHead.";
-			if (it2 == itList.end())
-				cout << "\tTail.";
-			cin.get();
-			it2++;
-		}
-		it2 = itList.begin();
-		cout << "How many iterator hops would you like to test? ";
-		(cin >> trials).get();
-
-		for (int i = 0; i < trials; i++)
-		{
-			cout << "Iterator: " << it2 << "\tValue: " << *it2;
-			if (it2 == itList.begin())
-				cout << "\tHead.";
-			if (it2 == itList.end())
-				cout << "\tTail.";
-			cin.get();
-			++it2;
-		}
-		it2 = itList.end();
-		cout << "How many iterator hops would you like to test? ";
-		(cin >> trials).get();
-
-		for (int i = 0; i < trials; i++)
-		{
-			cout << "Iterator: " << it2 << "\tValue: " << *it2;
-			if (it2 == itList.begin())
-				cout << "\tHead.";
-			if (it2 == itList.end())
-				cout << "\tTail.";
-			cin.get();
-			it2--;
-		}
-		it2 = itList.end();
-		cout << "How many iterator hops would you like to test? ";
-		(cin >> trials).get();
-
-		for (int i = 0; i < trials; i++)
-		{
-			cout << "Iterator: " << it2 << "\tValue: " << *it2;
-			if (it2 == itList.begin())
-				cout << "\tHead.";
-			if (it2 == itList.end())
-				cout << "\tTail.";
-			cin.get();
-			--it2;
-		}
-	}
-	catch (exception e)
-	{
-		cerr << "program terminated: " << e.what() << endl;
-		cin.get();
-	}
-
-}
-
-//----------------------------------------------------------------------------
-//	Function:		testExceptCDLL
-//
-//	Description:	Test driver for exceptions thrown by the circular 
-//						doubly-linked list.
-//
-//	Programmer:		David Landry
-//	
-//	Version:		1.0
-//
-//	Date:			5/19/2016
-//
-//	Environment:	Hardware:
-//						Intel Core i7 processor
-//					Software:
-//						PC powered by Windows 10
-//						Compiled using Microsoft Visual Studio Community 2013.
-//
-//	Parameters:		None
-//
-//	Returns:		None
-//
-//	Calls:			Various methods of the List class
-//
-//	Called by:		main
-//
-//	Input:			Prompts to continue.
-//
-//	Output:			Data from the List class
-//----------------------------------------------------------------------------
-void testExceptCDLL()
-{
-	List<int> tempEmpty;
-	cout << "Created a list of size " << tempEmpty.getSize() << "." << endl;
-	List<int>::iterator testIt;
-	testIt = tempEmpty.begin();
-	cout << "testIt: " << testIt << endl;
-	if (tempEmpty.empty())
-		cout << "tempEmpty is empty, as it should be." << endl;
-	else
-		cout << "tempEmpty is not empty.  Something's wrong." << endl;
-	try
-	{
-		//cout << tempEmpty.front();
-		//cout << tempEmpty.back();
-		//cout << tempEmpty.pop_back();
-		//cout << tempEmpty.pop_front();
-		testIt = tempEmpty.begin();
-		//cout << *testIt;
-		testIt = tempEmpty.end();
-		//cout << *testIt;
-		//cout << "Value at index 0 is " << tempEmpty[0];
-		//cout << "Value at index 5 is " << tempEmpty[5];
-		//testIt++;
-		//++testIt;
-		testIt--;
-		--testIt;
-	}
-	catch (runtime_error e)
-	{
-		cout << "Function failed:  " << e.what();
-	}
-	catch (out_of_range e)
-	{
-		cout << "Invalid index:  " << e.what();
-	}
-	cin.get();
-}
-
-//----------------------------------------------------------------------------
-//	Function:		testQueue
-//
-//	Description:	Test driver for a Queue inherited from a circular
-//						doubly-linked list.
-//
-//	Programmer:		David Landry
-//	
-//	Version:		1.0
-//
-//	Date:			5/19/2016
-//
-//	Environment:	Hardware:
-//						Intel Core i7 processor
-//					Software:
-//						PC powered by Windows 10
-//						Compiled using Microsoft Visual Studio Community 2013.
-//
-//	Parameters:		None
-//
-//	Returns:		None
-//
-//	Calls:			Various methods of the Queue class
-//
-//	Called by:		main
-//
-//	Input:			Prompts to continue.
-//
-//	Output:			Data from the Queue class
-//----------------------------------------------------------------------------
-void testQueue()
-{
-	try
-	{
-		cout << "Constructor Tests" << endl;
-		cout << "=================" << endl;
-		Queue<char> emptyQueue;
-		Queue<int> filledQueue(4, 5);
-		Queue<string> stringQueue(3, "Test string");
-		Queue<string> strQueue2(stringQueue);
-		cout << "emptyQueue: " << emptyQueue << "Size: " << 
-			emptyQueue.getSize() << endl << endl;
-		cout << "filledQueue (4 ints, each with value 5): " << filledQueue << 
-			"Size: " << filledQueue.getSize() << endl << endl;
-		cout << "stringQueue (3 strings, each with a test message): " << 
-			stringQueue << "Size: " << stringQueue.getSize() << endl << endl;
-		cout << "strQueue2 (copy of stringQueue): " << strQueue2 << "Size: " 
-			<< strQueue2.getSize() << endl << endl;
-		cout << "Press \"Enter\" to continue."; cin.get();
-		system("CLS");
-		cout << "Test other methods" << endl;
-		cout << "==================" << endl;
-		for (char pushStuff = 'A'; pushStuff <= 'E'; pushStuff++)
-		{
-			cout << "Adding " << pushStuff << " to the queue." << endl;
-			emptyQueue.push(pushStuff);
-		}
-		cout << "Filled emptyQueue: " << emptyQueue;
-		cout << "Creating a new queue, itQueue." << endl;
-		Queue<char> itQueue(emptyQueue.begin(), emptyQueue.end());
-		cout << "itQueue: " << itQueue;
-		cout << "First character: " << *itQueue.begin() << 
-			".  Last character: " << *itQueue.end() << endl;
-		cout << "Is stringQueue empty?  ";
-		if (stringQueue.empty())
-			cout << "Yes!" << endl;
-		else
-			cout << "No!" << endl;
-		cout << "Using release() on stringQueue to empty it:" << endl;
-		stringQueue.release();
-		cout << "Is stringQueue empty?  ";
-		if (stringQueue.empty())
-			cout << "Yes!" << endl;
-		else
-			cout << "No!" << endl;
-		cout << "Emptying itQueue one item at a time:" << endl;
-		unsigned size = itQueue.getSize();
-		for (short i = 0; i < size; i++)
-		{
-			cout << "Removing the " << itQueue.pop() << endl;
-		}
-		cout << "itQueue: " << itQueue << "Size: " << itQueue.getSize() << 
-			endl;
-		cout << "Press \"Enter\" to continue."; cin.get();
-	}
-	catch (exception e)
-	{
-		cout << e.what();
-	}
-
+//----------------------------------------------------------------------------
+//	File:		CDLLTester.cpp
+//
+//	Functions:	main()
+//				testCDLL()
+//				testExceptCDLL()
+//				testCursor()
+//				testQueue()
+//				testPool()
+//				testSentinel()
+//				testUnrolled()
+//				testConcurrent()
+//				testSPSC()
+//				testParallel()
+//				testParallelSort()
+//				testIndexed()
+//				testCache()
+//				testScheduler()
+//				testWorkStealing()
+//				testPriority()
+//				testBlocking()
+//				check()
+//				contents()
+//				pressEnter()
+//				nextLine()
+//				waitForEnter()
+//				clearScreen()
+//				readHops()
+//----------------------------------------------------------------------------
+// testExceptCDLL() needs the iterators to throw, even in a release build.
+#define DL_CDLL_CHECKED_ITERATORS 1
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include "CircDoubLinkList.h"
+#include "CDLL_Queue.h"
+#include "CDLL_PoolAllocator.h"
+#include "CDLL_SentinelList.h"
+#include "CDLL_UnrolledList.h"
+#include "CDLL_ConcurrentQueue.h"
+#include "CDLL_SPSCQueue.h"
+#include "CDLL_Parallel.h"
+#include "CDLL_IndexedList.h"
+#include "CDLL_Cache.h"
+#include "CDLL_Scheduler.h"
+#include "CDLL_WorkStealing.h"
+#include "CDLL_PriorityQueue.h"
+#include "CDLL_BlockingQueue.h"
+using namespace DL_CDLL;
+
+void testCDLL();
+void testQueue();
+void testExceptCDLL();
+void testCursor();
+void testPool();
+void testSentinel();
+void testUnrolled();
+void testConcurrent();
+void testSPSC();
+void testParallel();
+void testParallelSort();
+void testIndexed();
+void testCache();
+void testScheduler();
+void testWorkStealing();
+void testPriority();
+void testBlocking();
+void check(bool passed, const string& what);
+template<class Container>
+string contents(const Container& x);
+void pressEnter();
+void nextLine();
+void waitForEnter();
+void clearScreen();
+int readHops();
+
+// False when the tests were named on the command line: pauses and screen
+// clears are skipped and the iterator hop counts are fixed, so the tester
+// can run unattended.
+bool interactive = true;
+
+// The number of failed checks.  main() returns EXIT_FAILURE if any failed.
+int failures = 0;
+
+// The tests, by the name that runs them from the command line and the
+// title the menu shows.  "all" runs every one in this order.
+struct TestEntry
+{
+	const char* name;
+	const char* title;
+	void (*run)();
+};
+const TestEntry tests[] = {
+	{ "list", "CDLL standard tests.", testCDLL },
+	{ "except", "CDLL exception tests.", testExceptCDLL },
+	{ "cursor", "RoundRobinCursor tests.", testCursor },
+	{ "queue", "Queue tests.", testQueue },
+	{ "pool", "Pool allocator tests.", testPool },
+	{ "sentinel", "SentinelList tests.", testSentinel },
+	{ "unrolled", "UnrolledList tests.", testUnrolled },
+	{ "concurrent", "ConcurrentQueue tests.", testConcurrent },
+	{ "spsc", "SPSCQueue tests.", testSPSC },
+	{ "parallel", "Parallel traversal tests.", testParallel },
+	{ "psort", "Parallel sort tests.", testParallelSort },
+	{ "indexed", "IndexedList tests.", testIndexed },
+	{ "cache", "LRU and CLOCK cache tests.", testCache },
+	{ "scheduler", "Round-robin scheduler tests.", testScheduler },
+	{ "stealing", "Work stealing tests.", testWorkStealing },
+	{ "priority", "Priority queue tests.", testPriority },
+	{ "blocking", "BlockingQueue tests.", testBlocking },
+};
+const int testCount = sizeof(tests) / sizeof(tests[0]);
+
+// The number of blocks handed out by every TaggedAllocator and not yet
+// given back.  A test that ends with it above where it started leaked.
+int liveAllocations = 0;
+
+// How many more allocations TaggedAllocator allows before it throws
+// bad_alloc, or -1 for no limit.
+int allocationsLeft = -1;
+
+// While holdFreed is set, TaggedAllocator keeps the blocks it frees in
+// heldBlocks rather than giving them back, so no allocation can land on
+// one by chance.  While reuseFreed is also above zero, the next allocation
+// takes the block held last, as a real allocator may; each reuse counts
+// reuseFreed down.  The test frees what is left in heldBlocks.
+bool holdFreed = false;
+int reuseFreed = 0;
+vector<void*> heldBlocks;
+
+//----------------------------------------------------------------------------
+//	Class:			TaggedAllocator
+//
+//	Description:	A stateful allocator for the allocator-aware tests.
+//						Two TaggedAllocators are equal only when their
+//						tags match, so a test can give two containers
+//						allocators that cannot free each other's memory.
+//						Propagate sets all three propagate_on_container_
+//						traits.
+//----------------------------------------------------------------------------
+template<class T, bool Propagate = false>
+struct TaggedAllocator
+{
+	typedef T value_type;
+	typedef integral_constant<bool, Propagate>
+		propagate_on_container_copy_assignment;
+	typedef integral_constant<bool, Propagate>
+		propagate_on_container_move_assignment;
+	typedef integral_constant<bool, Propagate> propagate_on_container_swap;
+	template<class U>
+	struct rebind { typedef TaggedAllocator<U, Propagate> other; };
+
+	explicit TaggedAllocator(int t = 0) : tag(t) {}
+	template<class U>
+	TaggedAllocator(const TaggedAllocator<U, Propagate>& a) : tag(a.tag) {}
+	T* allocate(size_t n)
+	{
+		if (allocationsLeft == 0)
+			throw bad_alloc();
+		if (allocationsLeft > 0)
+			allocationsLeft--;
+		T* p;
+		if (holdFreed && reuseFreed > 0 && !heldBlocks.empty())
+		{
+			reuseFreed--;
+			p = static_cast<T*>(heldBlocks.back());
+			heldBlocks.pop_back();
+		}
+		else
+			p = static_cast<T*>(::operator new(n * sizeof(T)));
+		liveAllocations++;
+		return p;
+	}
+	void deallocate(T* p, size_t)
+	{
+		liveAllocations--;
+		if (holdFreed)
+			heldBlocks.push_back(p);
+		else
+			::operator delete(p);
+	}
+	bool operator==(const TaggedAllocator& rhs) const
+		{ return tag == rhs.tag; }
+	bool operator!=(const TaggedAllocator& rhs) const
+		{ return tag != rhs.tag; }
+
+	int tag;
+};
+
+// How many more times a Fragile may be copied before the copy throws, or
+// -1 for no limit.
+int copiesLeft = -1;
+
+//----------------------------------------------------------------------------
+//	Class:			Fragile
+//
+//	Description:	An int whose copy constructor throws runtime_error once
+//						copiesLeft runs out, for the exception-safety tests.
+//----------------------------------------------------------------------------
+struct Fragile
+{
+	Fragile(int v = 0) : value(v) {}
+	Fragile(const Fragile& x) : value(x.value)
+	{
+		if (copiesLeft == 0)
+			throw runtime_error("Fragile copy failed");
+		if (copiesLeft > 0)
+			copiesLeft--;
+	}
+	Fragile& operator=(const Fragile& x)
+	{
+		value = x.value;
+		return *this;
+	}
+
+	int value;
+};
+
+//----------------------------------------------------------------------------
+//	Function:		main
+//
+//	Description:	Main menu for testing List, Queue and the classes
+//						built on them.  If tests are named on the command
+//						line (any name in tests[], or all), runs them
+//						unattended instead.  Either way the tests check
+//						their results, and a failed check makes main()
+//						return EXIT_FAILURE.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.3
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		int argc- The number of command line arguments.
+//					char* argv[]- The names of the tests to run.
+//
+//	Returns:		EXIT_SUCCESS or EXIT_FAILURE
+//
+//	Calls:			The test functions in tests[]
+//
+//	Called by:		None
+//
+//	Input:			Menu prompt.
+//
+//	Output:			Menu options.
+//----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+	//using DL_CDLL::List; // not the same as std::list<class T>
+	if (argc > 1)
+	{
+		interactive = false;
+		for (int i = 1; i < argc; i++)
+		{
+			string name = argv[i];
+			bool all = (name == "all");
+			bool known = all;
+			for (int t = 0; t < testCount; t++)
+			{
+				if (all || name == tests[t].name)
+				{
+					known = true;
+					tests[t].run();
+				}
+			}
+			if (!known)
+			{
+				cerr << "Unknown test: " << name << endl;
+				cerr << "Tests:";
+				for (int t = 0; t < testCount; t++)
+					cerr << " " << tests[t].name << ",";
+				cerr << " all" << endl;
+				return EXIT_FAILURE;
+			}
+		}
+		if (failures > 0)
+			cerr << failures << " check(s) failed." << endl;
+		return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	unsigned short menuSelection;
+	do
+	{
+		system("CLS");
+		cout << "Select a test." << endl << endl;
+		for (int t = 0; t < testCount; t++)
+			cout << "\t" << t + 1 << ". " << tests[t].title << "\n";
+		cout << "\t0. Quit\n";
+		(cin >> menuSelection).get();
+		system("CLS");
+		if (menuSelection > 0 && menuSelection <= testCount)
+			tests[menuSelection - 1].run();
+	} while (menuSelection > 0);
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testCDLL
+//
+//	Description:	Test driver for a circular doubly-linked list.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			5/19/2016
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the List class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the List class
+//----------------------------------------------------------------------------
+void testCDLL()
+{
+	try
+	{
+		cout << "Constructor Tests" << endl;
+		cout << "=================" << endl;
+		List<char> emptyList;
+		List<int> filledList(4, 5);
+		List<string> stringList(3, "Test string");
+		List<string> strList2(stringList);
+		cout << "emptyList: " << emptyList << "Size: " << emptyList.getSize() 
+			<< endl << endl;
+		cout << "filledList (4 ints, each with value 5): " << filledList << 
+			"Size: " << filledList.getSize() << endl << endl;
+		cout << "stringList (3 strings, each with a test message): " << 
+			stringList << "Size: " << stringList.getSize() << endl << endl;
+		cout << "strList2 (copy of stringList): " << strList2 << "Size: " << 
+			strList2.getSize() << endl << endl;
+		check(emptyList.empty() && contents(emptyList) == "()",
+			"default constructor");
+		check(contents(filledList) == "(5,5,5,5)", "fill constructor");
+		check(stringList.getSize() == 3 && contents(strList2) ==
+			contents(stringList), "copy constructor");
+		pressEnter();
+		cout << "Various tests on fillList and itList" << endl;
+		cout << "====================================" << endl;
+		cout << "emptyList: " << emptyList;
+		for (char fillList = 'A'; fillList <= 'H'; fillList++)
+		{
+			cout << "Pushing " << fillList << " to the front." << endl;
+			emptyList.push_front(fillList);
+		}
+		cout << "emptyList now filled with letters: " << emptyList << "Size: " 
+			<< emptyList.getSize() << endl << endl;
+		List<char>::iterator itStart = emptyList.begin();
+		for (unsigned short i = 0; i < 4; i++)
+			itStart++;
+		List<char>::iterator itEnd = emptyList.end();
+		List<char> itList(itStart, itEnd);
+		cout << "itList (using iterators copying from emptyList): " << itList 
+			<< "Size: " << itList.getSize() << endl << endl;
+		cout << "First character in itList is " << *itList.begin() << endl;
+		cout << "Last character in itList is " << *itList.end() << endl;
+		cout << "Popping the " << emptyList.pop_front() << " from emptyList." 
+			<< endl;
+		cout << "Popping the " << emptyList.pop_front() << " from emptyList." 
+			<< endl;
+		cout << "Popping the " << emptyList.pop_front() << " from emptyList." 
+			<< endl;
+		cout << "emptyList: " << emptyList << "Size: " << emptyList.getSize() 
+			<< endl;
+		cout << "\tFront: " << emptyList.front() << "\tBack: " << 
+			emptyList.back() << endl;
+		check(contents(itList) == "(D,C,B,A)", "iterator range constructor");
+		check(contents(emptyList) == "(E,D,C,B,A)" &&
+			emptyList.front() == 'E' && emptyList.back() == 'A',
+			"push_front and pop_front");
+		pressEnter();
+		cout << "Remaining List Tests" << endl;
+		cout << "====================" << endl;
+		for (unsigned short i = 6; i <= 8; i++)
+		{
+			cout << "Pushing " << i << " to the end of filledList." << endl;
+			filledList.push_back(i);
+		}
+		cout << "filledList: " << filledList << "Size: " << 
+			filledList.getSize() << endl << endl;
+		check(contents(filledList) == "(5,5,5,5,6,7,8)", "push_back");
+		for (unsigned short i = 0; i < 4; i++)
+			cout << "Popping " << filledList.pop_back() << ":\n";
+		cout << "filledList: " << filledList << endl;
+		check(contents(filledList) == "(5,5,5)", "pop_back");
+		if (stringList.empty())
+			cout << "stringList is empty.";
+		else
+			cout << "stringList is NOT empty!";
+		cout << endl << "Using release() on stringList:" << endl;
+		stringList.release();
+		cout << "stringList: " << stringList << "Size: " << 
+			stringList.getSize();
+		check(stringList.empty() && stringList.getSize() == 0, "release");
+		if (stringList.empty())
+			cout << " stringList is now empty." << endl;
+		else
+			cout << " stringList is NOT empty!" << endl;
+		List<string> SL2;
+		SL2.push_back("this");
+		SL2.push_back("IS");
+		SL2.push_back("a");
+		SL2.push_back("TEST");
+		cout << "New created string list, SL2:" << endl << SL2;
+		cout << "Setting stringList equal to SL2.";
+		stringList = SL2;
+		cout << "stringList:\n" << stringList << "Size: " << 
+			stringList.getSize() << "  Empty? ";
+		if (stringList.empty())
+			cout << "Yes." << endl;
+		else
+			cout << "No." << endl;
+		check(contents(stringList) == "(this,IS,a,TEST)", "copy assignment");
+		cout << "stringList[0] should equal \"this\":  " << stringList[0] << 
+			endl;
+		cout << "stringList[-1] should equal \"TEST\":  " << stringList[-1] <<
+			endl;
+		const List<string>& constList = stringList;
+		cout << "Read through a const reference, stringList[-2] should "
+			"equal \"a\":  " << constList[-2] << endl;
+		cout << "Changing stringList[1]..." << endl;
+		check(stringList[0] == "this" && stringList[-1] == "TEST" &&
+			constList[-2] == "a", "operator[]");
+		stringList[1] = "BE";
+		cout << "stringList:" << stringList;
+		cout << "Emplacing 3 x's at the front and \"end\" at the back." << 
+			endl;
+		stringList.emplace_front(3, 'x');
+		stringList.emplace_back("end");
+		cout << "stringList:" << stringList;
+		check(contents(stringList) == "(xxx,this,BE,a,TEST,end)",
+			"emplace_front and emplace_back");
+		List<string> movedList(std::move(stringList));
+		cout << "movedList (moved from stringList):" << movedList << 
+			"Size: " << movedList.getSize() << "  stringList Size: " << 
+			stringList.getSize() << endl;
+		check(movedList.getSize() == 6 && stringList.empty(),
+			"move constructor");
+		stringList = std::move(movedList);
+		cout << "Moved back into stringList:" << stringList << 
+			"movedList Size: " << movedList.getSize() << endl;
+		check(contents(stringList) == "(xxx,this,BE,a,TEST,end)" &&
+			movedList.empty(), "move assignment");
+		pressEnter();
+		cout << "Splice Tests" << endl;
+		cout << "============" << endl;
+		List<string> secondHalf = stringList.split_at(++stringList.begin());
+		cout << "split_at the 2nd node leaves stringList:" << stringList << 
+			"and returns:" << secondHalf << "Sizes: " << 
+			stringList.getSize() << " and " << secondHalf.getSize() << endl;
+		check(contents(stringList) == "(xxx)" && contents(secondHalf) ==
+			"(this,BE,a,TEST,end)", "split_at");
+		stringList.splice(stringList.begin(), secondHalf, 
+			secondHalf.end());
+		cout << "Splicing secondHalf's tail in ahead of stringList's head:" 
+			<< stringList << "secondHalf:" << secondHalf;
+		check(contents(stringList) == "(end,xxx)" && contents(secondHalf) ==
+			"(this,BE,a,TEST)", "splice of one node");
+		stringList.concat(secondHalf);
+		cout << "Concatenating secondHalf onto stringList:" << stringList << 
+			"Size: " << stringList.getSize() << "  secondHalf Size: " << 
+			secondHalf.getSize() << endl;
+		check(contents(stringList) == "(end,xxx,this,BE,a,TEST)" &&
+			secondHalf.empty(), "concat");
+		SL2.splice(SL2.end(), stringList, ++stringList.begin(), 
+			--stringList.end());
+		cout << "Splicing the middle of stringList in ahead of SL2's tail:" 
+			<< SL2 << "stringList:" << stringList << "Sizes: " << 
+			SL2.getSize() << " and " << stringList.getSize() << endl;
+		check(contents(SL2) == "(this,IS,a,xxx,this,BE,a,TEST)" &&
+			contents(stringList) == "(end,TEST)", "splice of a range");
+		SL2.sort();
+		stringList.sort();
+		cout << "Sorting both:" << SL2 << "and:" << stringList;
+		check(contents(SL2) == "(BE,IS,TEST,a,a,this,this,xxx)" &&
+			contents(stringList) == "(TEST,end)", "sort");
+		SL2.merge(stringList);
+		cout << "Merging stringList into SL2:" << SL2 << "Sizes: " <<
+			SL2.getSize() << " and " << stringList.getSize() << endl;
+		check(contents(SL2) == "(BE,IS,TEST,TEST,a,a,end,this,this,xxx)" &&
+			stringList.empty(), "merge");
+		List<string>::iterator erased = SL2.erase(++SL2.begin());
+		SL2.insert(erased, "WAS");
+		cout << "Erasing SL2's 2nd node and inserting \"WAS\" in its place:"
+			<< SL2;
+		check(contents(SL2) == "(BE,WAS,TEST,TEST,a,a,end,this,this,xxx)",
+			"erase and insert");
+		pressEnter();
+		cout << "Iteration and Circularity Testing" << endl;
+		cout << "=================================" << endl;
+		cout << "Using itList for testing: " << itList;
+		List<char>::iterator it2 = itList.begin();
+		cout << "How many iterator hops would you like to test? ";
+		int trials = readHops();
+		
+		for (int i = 0; i < trials; i++)
+		{
+			cout << "Iterator: " << it2 << "\tValue: " << *it2;
+			if (it2 == itList.begin())
+				cout << "\tHead.";
+			if (it2 == itList.end())
+				cout << "\tTail.";
+			nextLine();
+			check(*it2 == "DCBA"[i % 4], "circular iteration");
+			it2++;
+		}
+		it2 = itList.begin();
+		cout << "How many iterator hops would you like to test? ";
+		trials = readHops();
+
+		for (int i = 0; i < trials; i++)
+		{
+			cout << "Iterator: " << it2 << "\tValue: " << *it2;
+			if (it2 == itList.begin())
+				cout << "\tHead.";
+			if (it2 == itList.end())
+				cout << "\tTail.";
+			nextLine();
+			check(*it2 == "DCBA"[i % 4], "circular iteration");
+			++it2;
+		}
+		it2 = itList.end();
+		cout << "How many iterator hops would you like to test? ";
+		trials = readHops();
+
+		for (int i = 0; i < trials; i++)
+		{
+			cout << "Iterator: " << it2 << "\tValue: " << *it2;
+			if (it2 == itList.begin())
+				cout << "\tHead.";
+			if (it2 == itList.end())
+				cout << "\tTail.";
+			nextLine();
+			check(*it2 == "ABCD"[i % 4], "circular iteration");
+			it2--;
+		}
+		it2 = itList.end();
+		cout << "How many iterator hops would you like to test? ";
+		trials = readHops();
+
+		for (int i = 0; i < trials; i++)
+		{
+			cout << "Iterator: " << it2 << "\tValue: " << *it2;
+			if (it2 == itList.begin())
+				cout << "\tHead.";
+			if (it2 == itList.end())
+				cout << "\tTail.";
+			nextLine();
+			check(*it2 == "ABCD"[i % 4], "circular iteration");
+			--it2;
+		}
+		cout << "std::find locates B " << distance(itList.begin(),
+			find(itList.begin(), itList.end(), 'B')) << " hops past the head."
+			<< endl;
+		check(distance(itList.begin(), find(itList.begin(), itList.end(), 'B'))
+			== 2, "std::find");
+		reverse(itList.begin(), itList.end());
+		cout << "std::reverse from the head up to the tail: " << itList;
+		check(contents(itList) == "(B,C,D,A)", "std::reverse");
+		reverse(itList.begin(), itList.end());
+		cout << "Range-for over itList:";
+		string ranged;
+		for (char c : itList.range())
+		{
+			cout << " " << c;
+			ranged += c;
+		}
+		check(ranged == "DCBA", "range-for");
+		cout << endl << "std::copy from cbegin() to cend(): ";
+		copy(itList.cbegin(), itList.cend(), ostream_iterator<char>(cout, " "));
+		cout << endl;
+	}
+	catch (const exception& e)
+	{
+		cerr << "program terminated: " << e.what() << endl;
+		check(false, "no exception escapes the list tests");
+		pressEnter();
+	}
+
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testExceptCDLL
+//
+//	Description:	Test driver for exceptions thrown by the circular 
+//						doubly-linked list.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			5/19/2016
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the List class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the List class
+//----------------------------------------------------------------------------
+void testExceptCDLL()
+{
+	List<int> tempEmpty;
+	cout << "Created a list of size " << tempEmpty.getSize() << "." << endl;
+	List<int>::iterator testIt;
+	testIt = tempEmpty.begin();
+	cout << "testIt: " << testIt << endl;
+	if (tempEmpty.empty())
+		cout << "tempEmpty is empty, as it should be." << endl;
+	else
+		cout << "tempEmpty is not empty.  Something's wrong." << endl;
+	check(tempEmpty.empty(), "a new list is empty");
+	int popped;
+	bool popFailed = 
+		!tempEmpty.try_pop_front(popped) && !tempEmpty.try_pop_back(popped);
+	if (popFailed)
+		cout << "try_pop_front and try_pop_back found tempEmpty empty "
+			<< "without throwing." << endl;
+	check(popFailed, "try_pop on an empty list");
+	bool threw = false;
+	try
+	{
+		//cout << tempEmpty.front();
+		//cout << tempEmpty.back();
+		//cout << tempEmpty.pop_back();
+		//cout << tempEmpty.pop_front();
+		testIt = tempEmpty.begin();
+		//cout << *testIt;
+		testIt = tempEmpty.end();
+		//cout << *testIt;
+		//cout << "Value at index 0 is " << tempEmpty[0];
+		//cout << "Value at index 5 is " << tempEmpty[5];
+		//testIt++;
+		//++testIt;
+		testIt--;
+		--testIt;
+	}
+	catch (const runtime_error& e)
+	{
+		cout << "Function failed:  " << e.what();
+		threw = true;
+	}
+	catch (const out_of_range& e)
+	{
+		cout << "Invalid index:  " << e.what();
+		threw = true;
+	}
+	check(threw, "a checked iterator on an empty list throws");
+	nextLine();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testCursor
+//
+//	Description:	Test driver for RoundRobinCursor and List::advance,
+//						including an empty list, which must throw.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the RoundRobinCursor and List
+//						classes
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the RoundRobinCursor and List classes
+//----------------------------------------------------------------------------
+void testCursor()
+{
+	try
+	{
+		cout << "RoundRobinCursor Tests" << endl;
+		cout << "======================" << endl;
+		List<int> ring;
+		for (int i = 0; i < 5; i++)
+			ring.push_back(i);
+		RoundRobinCursor<int> cursor(ring);
+		ostringstream order;
+		for (int i = 0; i < 7; i++)
+			order << cursor.next();
+		cout << "seven turns: " << order.str() << endl;
+		check(order.str() == "0123401" && cursor.current() == 2,
+			"RoundRobinCursor wraps from the tail to the head");
+		cursor.advance(4);
+		check(cursor.current() == 1, "RoundRobinCursor advance forward");
+		cursor.advance(-3);
+		check(cursor.current() == 3, "RoundRobinCursor advance backward");
+		cursor.advance(12);
+		check(cursor.current() == 0,
+			"RoundRobinCursor advance past the size wraps");
+		check(contents(ring) == "(0,1,2,3,4)",
+			"RoundRobinCursor leaves the list's order alone");
+		cursor.advance(-1);
+		cursor.erase();
+		check(contents(ring) == "(0,1,2,3)" && cursor.current() == 0,
+			"RoundRobinCursor erase at the tail moves on to the head");
+		cursor.reset();
+		cursor.advance(2);
+		check(cursor.current() == 2 && *ring.advance(ring.begin(), -1) == 3,
+			"RoundRobinCursor reset and List advance");
+
+		while (!ring.empty())
+			cursor.erase();
+		bool threw = false;
+		try
+		{
+			cursor.current();
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(threw, "RoundRobinCursor on an empty list throws");
+		threw = false;
+		try
+		{
+			cursor.advance(1);
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(threw, "RoundRobinCursor advance on an empty list throws");
+
+		// A node of another list must not get as far as k % 0.
+		List<int> other;
+		other.push_back(9);
+		threw = false;
+		try
+		{
+			ring.advance(other.begin(), 3);
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(threw, "List advance on an empty list throws");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the RoundRobinCursor tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testQueue
+//
+//	Description:	Test driver for a Queue inherited from a circular
+//						doubly-linked list.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			5/19/2016
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the Queue class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the Queue class
+//----------------------------------------------------------------------------
+void testQueue()
+{
+	try
+	{
+		cout << "Constructor Tests" << endl;
+		cout << "=================" << endl;
+		Queue<char> emptyQueue;
+		Queue<int> filledQueue(4, 5);
+		Queue<string> stringQueue(3, "Test string");
+		Queue<string> strQueue2(stringQueue);
+		cout << "emptyQueue: " << emptyQueue << "Size: " << 
+			emptyQueue.getSize() << endl << endl;
+		cout << "filledQueue (4 ints, each with value 5): " << filledQueue << 
+			"Size: " << filledQueue.getSize() << endl << endl;
+		cout << "stringQueue (3 strings, each with a test message): " << 
+			stringQueue << "Size: " << stringQueue.getSize() << endl << endl;
+		cout << "strQueue2 (copy of stringQueue): " << strQueue2 << "Size: " 
+			<< strQueue2.getSize() << endl << endl;
+		check(emptyQueue.empty() && contents(filledQueue) == "(5,5,5,5)" &&
+			contents(strQueue2) == contents(stringQueue),
+			"queue constructors");
+		pressEnter();
+		cout << "Test other methods" << endl;
+		cout << "==================" << endl;
+		for (char pushStuff = 'A'; pushStuff <= 'E'; pushStuff++)
+		{
+			cout << "Adding " << pushStuff << " to the queue." << endl;
+			emptyQueue.push(pushStuff);
+		}
+		cout << "Filled emptyQueue: " << emptyQueue;
+		check(contents(emptyQueue) == "(A,B,C,D,E)", "push");
+		emptyQueue.rotate(2);
+		cout << "Rotated by 2: " << emptyQueue;
+		check(contents(emptyQueue) == "(C,D,E,A,B)", "rotate forward");
+		emptyQueue.rotate(-2);
+		cout << "Rotated back by -2: " << emptyQueue;
+		check(contents(emptyQueue) == "(A,B,C,D,E)", "rotate backward");
+		cout << "Creating a new queue, itQueue." << endl;
+		Queue<char> itQueue(emptyQueue.begin(), emptyQueue.end());
+		cout << "itQueue: " << itQueue;
+		cout << "First character: " << *itQueue.begin() << 
+			".  Last character: " << *itQueue.end() << endl;
+		cout << "Is stringQueue empty?  ";
+		if (stringQueue.empty())
+			cout << "Yes!" << endl;
+		else
+			cout << "No!" << endl;
+		cout << "Using release() on stringQueue to empty it:" << endl;
+		stringQueue.release();
+		cout << "Is stringQueue empty?  ";
+		if (stringQueue.empty())
+			cout << "Yes!" << endl;
+		else
+			cout << "No!" << endl;
+		check(stringQueue.empty(), "queue release");
+		cout << "Emptying itQueue one item at a time:" << endl;
+		unsigned size = itQueue.getSize();
+		string removed;
+		for (unsigned i = 0; i < size; i++)
+		{
+			char item = itQueue.pop();
+			cout << "Removing the " << item << endl;
+			removed += item;
+		}
+		check(removed == "ABCDE" && itQueue.empty(), "pop order");
+		cout << "itQueue: " << itQueue << "Size: " << itQueue.getSize() << 
+			endl;
+		strQueue2.emplace(2, '!');
+		Queue<string> movedQueue(std::move(strQueue2));
+		cout << "movedQueue (moved from strQueue2 after emplacing \"!!\"): " 
+			<< movedQueue << "Size: " << movedQueue.getSize() << 
+			"  strQueue2 Size: " << strQueue2.getSize() << endl;
+		check(movedQueue.getSize() == 4 && strQueue2.empty(),
+			"emplace and queue move constructor");
+		int batch[] = { 1, 2, 3, 4, 5 };
+		Queue<int> batchQueue;
+		batchQueue.push_range(batch, batch + 5);
+		batchQueue.push_n(3, 0);
+		cout << "batchQueue (1 to 5 pushed as a range, then 3 zeros): " <<
+			batchQueue;
+		check(contents(batchQueue) == "(1,2,3,4,5,0,0,0)",
+			"push_range and push_n");
+		int popped[4];
+		batchQueue.pop_n(popped, 4);
+		check(popped[0] == 1 && popped[3] == 4 &&
+			contents(batchQueue) == "(5,0,0,0)", "pop_n");
+		cout << "pop_n took " << popped[0] << " through " << popped[3] <<
+			", leaving: " << batchQueue;
+		batchQueue.drain_into(filledQueue);
+		cout << "filledQueue after batchQueue drained into it: " <<
+			filledQueue << "batchQueue Size: " << batchQueue.getSize() <<
+			endl;
+		int queueSum = 0;
+		for (int item : filledQueue.range())
+			queueSum += item;
+		cout << "Range-for sum of filledQueue: " << queueSum << endl;
+		check(contents(filledQueue) == "(5,5,5,5,5,0,0,0)" &&
+			batchQueue.empty() && queueSum == 25, "drain_into");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the queue tests");
+	}
+
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testPool
+//
+//	Description:	Test driver for a List and a Queue whose nodes come from
+//						a PoolAllocator.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the List, Queue and PoolAllocator
+//						classes
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the List and Queue classes and pool counters
+//----------------------------------------------------------------------------
+void testPool()
+{
+	try
+	{
+		cout << "Pool Allocator Tests" << endl;
+		cout << "====================" << endl;
+		PoolAllocator<int> intPool;
+		List<int, PoolAllocator<int> > poolList(intPool);
+		for (int i = 1; i <= 5; i++)
+			poolList.push_back(i);
+		cout << "poolList: " << poolList << "Size: " << poolList.getSize() 
+			<< "  Nodes in use: " << intPool.pool().inUse() << endl;
+		List<int, PoolAllocator<int> > poolCopy(poolList);
+		cout << "poolCopy (copy of poolList): " << poolCopy << 
+			"Nodes in use (shared pool): " << intPool.pool().inUse() << endl;
+		poolCopy.release();
+		cout << "After poolCopy.release(), nodes in use: " << 
+			intPool.pool().inUse() << endl << endl;
+		check(contents(poolCopy) == "()" && intPool.pool().inUse() == 5,
+			"pooled list copy and release");
+
+		Queue<string, PoolAllocator<string> > poolQueue;
+		NodePool& pool = poolQueue.get_allocator().pool();
+		for (int i = 0; i < 100; i++)
+			poolQueue.push("warm-up");
+		size_t chunks = pool.chunkCount();
+		cout << "Chunks after filling poolQueue with 100 strings: " << chunks 
+			<< endl;
+		for (int cycle = 0; cycle < 100000; cycle++)
+		{
+			poolQueue.push("steady state");
+			poolQueue.pop();
+		}
+		cout << "Chunks after 100000 push/pop cycles: " << pool.chunkCount();
+		if (pool.chunkCount() == chunks)
+			cout << "  (no new chunks, as it should be)" << endl;
+		else
+			cout << "  Something's wrong." << endl;
+		cout << "Nodes in use: " << pool.inUse() << "  Queue size: " << 
+			poolQueue.getSize() << endl;
+		check(pool.chunkCount() == chunks && pool.inUse() == 100,
+			"pooled queue reuses its nodes");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the pool tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testSentinel
+//
+//	Description:	Test driver for the sentinel-node SentinelList.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the SentinelList class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the SentinelList class
+//----------------------------------------------------------------------------
+void testSentinel()
+{
+	try
+	{
+		cout << "SentinelList Tests" << endl;
+		cout << "==================" << endl;
+		typedef SentinelList<string, TaggedAllocator<string> > TaggedList;
+		typedef SentinelList<string, TaggedAllocator<string, true> >
+			SharedList;
+		int allocated = liveAllocations;
+		{
+			SentinelList<int> ints;
+			check(ints.empty() && ints.begin() == ints.end(),
+				"an empty SentinelList");
+			for (int i = 1; i <= 3; i++)
+				ints.push_back(i);
+			ints.push_front(0);
+			ints.emplace_back(4);
+			cout << "ints: " << ints;
+			check(contents(ints) == "(0,1,2,3,4)" && ints.getSize() == 5,
+				"SentinelList push_front and push_back");
+			SentinelList<int>::iterator it = ints.end();
+			++it;
+			check(*it == 0, "SentinelList iteration wraps past the sentinel");
+			--it;
+			check(*it == 4,
+				"SentinelList iteration wraps back past the sentinel");
+			check(&++it == &it && &--it == &it,
+				"SentinelList prefix ++ and -- return the iterator");
+			check(ints.pop_front() == 0 && ints.pop_back() == 4 &&
+				ints.front() == 1 && ints.back() == 3,
+				"SentinelList pop_front and pop_back");
+			ints.release();
+			check(ints.empty() && ints.getSize() == 0, "SentinelList release");
+			bool threw = false;
+			try
+			{
+				ints.pop_front();
+			}
+			catch (const runtime_error&)
+			{
+				threw = true;
+			}
+			check(threw, "SentinelList pop_front on an empty list throws");
+
+			TaggedList first(TaggedAllocator<string>(1));
+			first.push_back("a");
+			first.push_back("b");
+			TaggedList copy(first);
+			check(contents(copy) == "(a,b)" &&
+				copy.get_allocator() == first.get_allocator(),
+				"SentinelList copy constructor");
+			TaggedList other(TaggedAllocator<string>(2));
+			other.push_back("z");
+			other = first;
+			check(contents(other) == "(a,b)" &&
+				other.get_allocator().tag == 2,
+				"SentinelList copy assignment keeps a non-propagating "
+				"allocator");
+			SharedList shared(TaggedAllocator<string, true>(3));
+			shared.push_back("z");
+			SharedList source(TaggedAllocator<string, true>(4));
+			source.push_back("c");
+			shared = source;
+			check(contents(shared) == "(c)" &&
+				shared.get_allocator().tag == 4,
+				"SentinelList copy assignment propagates the allocator");
+			other = std::move(first);
+			check(contents(other) == "(a,b)" && first.empty() &&
+				other.get_allocator().tag == 2,
+				"SentinelList move assignment between unequal allocators");
+			TaggedList moved(std::move(other));
+			check(contents(moved) == "(a,b)" && other.empty(),
+				"SentinelList move constructor");
+			check(is_nothrow_move_constructible<TaggedList>::value,
+				"SentinelList's move constructor is noexcept");
+			vector<SentinelList<int> > lists(1, SentinelList<int>(2, 7));
+			lists.resize(8);
+			check(contents(lists[0]) == "(7,7)",
+				"vector<SentinelList> keeps its lists as it grows");
+		}
+		check(liveAllocations == allocated, "SentinelList frees every node");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the SentinelList tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testUnrolled
+//
+//	Description:	Test driver for the chunked UnrolledList, including its
+//						behaviour when a copy or a chunk allocation throws.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the UnrolledList class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the UnrolledList class
+//----------------------------------------------------------------------------
+void testUnrolled()
+{
+	try
+	{
+		cout << "UnrolledList Tests" << endl;
+		cout << "==================" << endl;
+		typedef UnrolledList<int, 4> SmallChunks;
+		typedef UnrolledList<int, 4, TaggedAllocator<int> > TaggedList;
+		typedef UnrolledList<int, 4, TaggedAllocator<int, true> > SharedList;
+		typedef UnrolledList<Fragile, 4, TaggedAllocator<Fragile> >
+			FragileList;
+		int allocated = liveAllocations;
+		{
+			SmallChunks ints;
+			for (int i = 1; i <= 10; i++)
+				ints.push_back(i);
+			ints.push_front(0);
+			ints.emplace_front(-1);
+			cout << "ints (4 to a chunk): " << ints;
+			check(contents(ints) == "(-1,0,1,2,3,4,5,6,7,8,9,10)" &&
+				ints.getSize() == 12, "UnrolledList push_front and push_back");
+			check(ints[0] == -1 && ints[5] == 4 && ints[11] == 10 &&
+				ints[-1] == 10 && ints[-12] == -1,
+				"UnrolledList operator[] across chunks");
+			SmallChunks::iterator it = ints.end();
+			it++;
+			check(*it == -1, "UnrolledList iteration wraps to the head");
+			it--;
+			check(*it == 10, "UnrolledList iteration wraps back to the tail");
+			string popped;
+			for (int i = 0; i < 3; i++)
+				popped += to_string(ints.pop_front()) + ",";
+			for (int i = 0; i < 3; i++)
+				popped += to_string(ints.pop_back()) + ",";
+			check(popped == "-1,0,1,10,9,8," &&
+				contents(ints) == "(2,3,4,5,6,7)" && ints.front() == 2 &&
+				ints.back() == 7, "UnrolledList pop_front and pop_back");
+			while (!ints.empty())
+				ints.pop_back();
+			ints.push_front(42);
+			check(contents(ints) == "(42)", "UnrolledList reuse after empty");
+
+			TaggedList first(TaggedAllocator<int>(1));
+			for (int i = 0; i < 6; i++)
+				first.push_back(i);
+			TaggedList copy(first);
+			check(contents(copy) == "(0,1,2,3,4,5)",
+				"UnrolledList copy constructor");
+			TaggedList other(TaggedAllocator<int>(2));
+			other.push_back(9);
+			other = first;
+			check(contents(other) == "(0,1,2,3,4,5)" &&
+				other.get_allocator().tag == 2,
+				"UnrolledList copy assignment keeps a non-propagating "
+				"allocator");
+			SharedList shared(TaggedAllocator<int, true>(3));
+			SharedList source(TaggedAllocator<int, true>(4));
+			source.push_back(7);
+			shared = source;
+			check(contents(shared) == "(7)" &&
+				shared.get_allocator().tag == 4,
+				"UnrolledList copy assignment propagates the allocator");
+			other = std::move(first);
+			check(contents(other) == "(0,1,2,3,4,5)" && first.empty() &&
+				other.get_allocator().tag == 2,
+				"UnrolledList move assignment between unequal allocators");
+			check(is_nothrow_move_constructible<TaggedList>::value,
+				"UnrolledList's move constructor is noexcept");
+
+			FragileList fragile(TaggedAllocator<Fragile>(5));
+			for (int i = 0; i < 10; i++)
+				fragile.push_back(Fragile(i));
+			int before = liveAllocations;
+			bool threw = false;
+			copiesLeft = 6;
+			try
+			{
+				FragileList failed(fragile);
+			}
+			catch (const runtime_error&)
+			{
+				threw = true;
+			}
+			copiesLeft = -1;
+			check(threw && liveAllocations == before,
+				"a throwing UnrolledList copy frees its chunks");
+			threw = false;
+			allocationsLeft = 2;
+			try
+			{
+				TaggedList failed(10, 1, TaggedAllocator<int>(6));
+			}
+			catch (const bad_alloc&)
+			{
+				threw = true;
+			}
+			allocationsLeft = -1;
+			check(threw && liveAllocations == before,
+				"a failed UnrolledList fill frees its chunks");
+		}
+		check(liveAllocations == allocated,
+			"UnrolledList frees every chunk");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		copiesLeft = allocationsLeft = -1;
+		cout << e.what();
+		check(false, "no exception escapes the UnrolledList tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testConcurrent
+//
+//	Description:	Test driver for the two-lock ConcurrentQueue, with
+//						several producer and consumer threads sharing one
+//						queue.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the ConcurrentQueue class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the ConcurrentQueue class
+//----------------------------------------------------------------------------
+void testConcurrent()
+{
+	try
+	{
+		cout << "ConcurrentQueue Tests" << endl;
+		cout << "=====================" << endl;
+		ConcurrentQueue<string> words;
+		string word;
+		check(words.empty() && !words.try_pop(word),
+			"try_pop on an empty ConcurrentQueue");
+		words.push("first");
+		words.emplace(3, 'z');
+		check(words.getSize() == 2 && words.pop() == "first" &&
+			words.try_pop(word) && word == "zzz" && words.empty(),
+			"ConcurrentQueue push, emplace and pop");
+		bool threw = false;
+		try
+		{
+			words.pop();
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(threw, "ConcurrentQueue pop on an empty queue throws");
+
+		// Four producers and four consumers share one queue.  Each item is
+		// its producer's number times perProducer plus its own sequence
+		// number, so every consumer must see each producer's items in
+		// increasing order, and together they must see each item once.
+		const int producers = 4, consumers = 4, perProducer = 20000;
+		const int total = producers * perProducer;
+		ConcurrentQueue<int> shared; // std::allocator is thread-safe
+		atomic<int> taken(0);
+		vector<vector<int> > seen(consumers);
+		vector<thread> threads;
+		for (int p = 0; p < producers; p++)
+			threads.push_back(thread([&shared, p, perProducer]()
+			{
+				for (int i = 0; i < perProducer; i++)
+					shared.push(p * perProducer + i);
+			}));
+		for (int c = 0; c < consumers; c++)
+			threads.push_back(thread([&shared, &taken, &seen, c, total]()
+			{
+				int item;
+				while (taken.load() < total)
+				{
+					if (shared.try_pop(item))
+					{
+						seen[c].push_back(item);
+						taken++;
+					}
+					else
+						this_thread::yield();
+				}
+			}));
+		for (size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+		vector<int> times(total, 0);
+		bool ordered = true;
+		for (int c = 0; c < consumers; c++)
+		{
+			vector<int> last(producers, -1);
+			for (size_t i = 0; i < seen[c].size(); i++)
+			{
+				int item = seen[c][i];
+				times[item]++;
+				if (item <= last[item / perProducer])
+					ordered = false;
+				last[item / perProducer] = item;
+			}
+		}
+		cout << producers << " producers and " << consumers <<
+			" consumers passed " << taken.load() << " items." << endl;
+		check(count(times.begin(), times.end(), 1) == total,
+			"ConcurrentQueue delivers every item exactly once");
+		check(ordered, "ConcurrentQueue keeps each producer's order");
+		check(shared.empty() && shared.getSize() == 0,
+			"ConcurrentQueue is empty afterwards");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the ConcurrentQueue tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testSPSC
+//
+//	Description:	Test driver for the bounded single-producer/single-
+//						consumer SPSCQueue, on one thread and then across two.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the SPSCQueue class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the SPSCQueue class
+//----------------------------------------------------------------------------
+void testSPSC()
+{
+	try
+	{
+		cout << "SPSCQueue Tests" << endl;
+		cout << "===============" << endl;
+		SPSCQueue<string> ring(5);
+		cout << "A queue asked for 5 slots has " << ring.capacity() << "."
+			<< endl;
+		check(ring.capacity() == 8, "SPSCQueue rounds its capacity up");
+		string word;
+		check(ring.empty() && !ring.try_pop(word),
+			"try_pop on an empty SPSCQueue");
+		for (int i = 0; i < 8; i++)
+			ring.push(to_string(i));
+		bool threw = false;
+		try
+		{
+			ring.push("overflow");
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(ring.getSize() == 8 && !ring.try_push("overflow") && threw,
+			"a full SPSCQueue refuses a push");
+		string order;
+		while (ring.try_pop(word))
+			order += word;
+		threw = false;
+		try
+		{
+			ring.pop();
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(order == "01234567" && ring.empty() && threw,
+			"SPSCQueue pops in order down to empty");
+		// Three at a time, so the indices wrap the ring at every offset.
+		bool wrapped = true;
+		int next = 0, expected = 0;
+		for (int round = 0; round < 40; round++)
+		{
+			for (int i = 0; i < 3; i++)
+				ring.push(to_string(next++));
+			for (int i = 0; i < 3; i++)
+				if (ring.pop() != to_string(expected++))
+					wrapped = false;
+		}
+		check(wrapped && ring.empty(),
+			"SPSCQueue keeps its order as the indices wrap the ring");
+
+		// One producer and one consumer through a four-slot ring, so both
+		// keep running into the full and empty edges.
+		const int items = 200000;
+		SPSCQueue<int> narrow(4);
+		bool inOrder = true;
+		thread consumer([&narrow, &inOrder, items]()
+		{
+			int item;
+			for (int want = 0; want < items; )
+			{
+				if (!narrow.try_pop(item))
+				{
+					this_thread::yield();
+					continue;
+				}
+				if (item != want)
+					inOrder = false;
+				want++;
+			}
+		});
+		for (int i = 0; i < items; )
+		{
+			if (narrow.try_push(i))
+				i++;
+			else
+				this_thread::yield();
+		}
+		consumer.join();
+		cout << items << " items passed through a ring of " <<
+			narrow.capacity() << "." << endl;
+		check(inOrder && narrow.empty(),
+			"SPSCQueue delivers a producer's items in order to a consumer");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the SPSCQueue tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testParallel
+//
+//	Description:	Test driver for parallel_for_each, parallel_transform
+//						and parallel_reduce.  Each result is checked
+//						against the same work done serially.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			parallel_for_each(), parallel_transform(),
+//						parallel_reduce()
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the parallel functions
+//----------------------------------------------------------------------------
+void testParallel()
+{
+	try
+	{
+		cout << "Parallel Traversal Tests" << endl;
+		cout << "========================" << endl;
+		const unsigned sizes[] = { 0, 1, 3, 1000 };
+		const unsigned threadCounts[] = { 1, 2, 3, 8, 0 };
+		bool forEachMatches = true, transformMatches = true;
+		bool reduceMatches = true;
+		for (unsigned size : sizes)
+		{
+			for (unsigned threads : threadCounts)
+			{
+				List<int> numbers;
+				vector<int> serial;
+				for (unsigned i = 1; i <= size; i++)
+				{
+					numbers.push_back(i);
+					serial.push_back(i);
+				}
+				parallel_for_each(numbers, [](int& v) { v *= 3; }, threads);
+				for (int& v : serial)
+					v *= 3;
+				if (!equal(serial.begin(), serial.end(),
+						numbers.range().begin()) ||
+						numbers.getSize() != size)
+					forEachMatches = false;
+				parallel_transform(numbers, [](int v) { return v - 1; },
+					threads);
+				for (int& v : serial)
+					v = v - 1;
+				if (!equal(serial.begin(), serial.end(),
+						numbers.range().begin()))
+					transformMatches = false;
+				// Concatenation is associative but not commutative, so
+				// the result also shows the segments combine in order.
+				List<string> words;
+				string joined = "<";
+				for (unsigned i = 0; i < size; i++)
+				{
+					words.push_back(to_string(i % 10));
+					joined += to_string(i % 10);
+				}
+				string reduced = parallel_reduce(words, string("<"),
+					[](const string& a, const string& b) { return a + b; },
+					threads);
+				long long total = parallel_reduce(numbers, 0LL,
+					[](long long a, long long b) { return a + b; }, threads);
+				long long serialTotal = 0;
+				for (int v : serial)
+					serialTotal += v;
+				if (reduced != joined || total != serialTotal)
+					reduceMatches = false;
+			}
+		}
+		cout << "Lists of 0, 1, 3 and 1000 elements on 1, 2, 3, 8 and the "
+			"default number of threads." << endl;
+		check(forEachMatches, "parallel_for_each matches a serial loop");
+		check(transformMatches, "parallel_transform matches a serial loop");
+		check(reduceMatches,
+			"parallel_reduce matches a serial loop, in list order");
+
+		Queue<int> queued;
+		for (int i = 1; i <= 10; i++)
+			queued.push(i);
+		parallel_for_each(queued, [](int& v) { v = -v; }, 4);
+		check(contents(queued) == "(-1,-2,-3,-4,-5,-6,-7,-8,-9,-10)",
+			"parallel_for_each over a Queue");
+
+		List<int> faulty;
+		for (int i = 1; i <= 1000; i++)
+			faulty.push_back(i);
+		string message;
+		try
+		{
+			parallel_for_each(faulty, [](int& v)
+			{
+				if (v % 250 == 0)
+					throw runtime_error(to_string(v));
+			}, 4);
+		}
+		catch (const runtime_error& e)
+		{
+			message = e.what();
+		}
+		cout << "Every fourth segment threw; the caller saw " << message <<
+			"." << endl;
+		check(message == "250",
+			"parallel_for_each rethrows the first segment's exception");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the parallel traversal tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testParallelSort
+//
+//	Description:	Test driver for parallel_sort.  Each result is checked
+//						against std::sort, and against std::stable_sort for
+//						stability.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			parallel_sort(), sort(), stable_sort()
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from parallel_sort
+//----------------------------------------------------------------------------
+void testParallelSort()
+{
+	try
+	{
+		cout << "Parallel Sort Tests" << endl;
+		cout << "===================" << endl;
+		const unsigned sizes[] = { 0, 1, 2, 3, 7, 1000, 4099 };
+		const unsigned threadCounts[] = { 1, 2, 3, 8, 0 };
+		bool sortedMatches = true, stable = true;
+		unsigned seed = 12345;
+		for (unsigned size : sizes)
+		{
+			for (unsigned threads : threadCounts)
+			{
+				List<int> numbers;
+				vector<int> serial;
+				// Keys from 0 to 9 with the original position in the low
+				// digits, so the order among equal keys shows stability.
+				List<int> keyed;
+				vector<int> serialKeyed;
+				for (unsigned i = 0; i < size; i++)
+				{
+					seed = seed * 1103515245u + 12345u;
+					int value = static_cast<int>(seed >> 8) % 100000;
+					numbers.push_back(value);
+					serial.push_back(value);
+					int key = value % 10 * 10000 + static_cast<int>(i);
+					keyed.push_back(key);
+					serialKeyed.push_back(key);
+				}
+				parallel_sort(numbers, threads);
+				sort(serial.begin(), serial.end());
+				if (numbers.getSize() != size || !equal(serial.begin(),
+						serial.end(), numbers.range().begin()))
+					sortedMatches = false;
+				auto byKey = [](int a, int b) { return a / 10000 < b / 10000; };
+				parallel_sort(keyed, byKey, threads);
+				stable_sort(serialKeyed.begin(), serialKeyed.end(), byKey);
+				if (!equal(serialKeyed.begin(), serialKeyed.end(),
+						keyed.range().begin()))
+					stable = false;
+			}
+		}
+		cout << "Lists of 0 to 4099 elements on 1, 2, 3, 8 and the default "
+			"number of threads." << endl;
+		check(sortedMatches, "parallel_sort matches std::sort");
+		check(stable, "parallel_sort is stable, as std::stable_sort is");
+
+		List<string> words;
+		words.push_back("pear");
+		words.push_back("fig");
+		words.push_back("apple");
+		words.push_back("kiwi");
+		parallel_sort(words, greater<string>(), 8);
+		cout << "Sorted in descending order on 8 threads: " << words;
+		check(contents(words) == "(pear,kiwi,fig,apple)",
+			"parallel_sort with a comparison and more threads than pairs");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the parallel sort tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testIndexed
+//
+//	Description:	Test driver for the hash-indexed IndexedList,
+//						including move assignment between unequal
+//						allocators.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the IndexedList class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the IndexedList class
+//----------------------------------------------------------------------------
+void testIndexed()
+{
+	try
+	{
+		cout << "IndexedList Tests" << endl;
+		cout << "=================" << endl;
+		int allocated = liveAllocations;
+		{
+			IndexedList<string> names;
+			names.push_back("ann");
+			names.push_back("bob");
+			names.push_front("cat");
+			names.insert(names.find("bob"), "dan");
+			cout << "names: " << names;
+			check(contents(names) == "(cat,ann,dan,bob)" &&
+				names.contains("dan") && !names.contains("eve"),
+				"IndexedList push, insert and contains");
+			bool threw = false;
+			try
+			{
+				names.push_back("ann");
+			}
+			catch (const runtime_error&)
+			{
+				threw = true;
+			}
+			check(threw && names.getSize() == 4,
+				"IndexedList refuses a duplicate key");
+			names.move_to_front(names.find("bob"));
+			names.move_to_back(names.find("cat"));
+			check(contents(names) == "(bob,ann,dan,cat)",
+				"IndexedList move_to_front and move_to_back");
+			check(names.erase("ann") && !names.erase("ann") &&
+				names.pop_front() == "bob" && !names.contains("bob") &&
+				contents(names) == "(dan,cat)",
+				"IndexedList erase by key and pop_front");
+			names.erase(names.find("cat"));
+			check(contents(names) == "(dan)" && !names.contains("cat"),
+				"IndexedList erase at an iterator");
+
+			typedef IndexedList<int, IdentityKey<int>, hash<int>,
+				TaggedAllocator<int> > TaggedIndex;
+			TaggedIndex first(IdentityKey<int>(), hash<int>(),
+				TaggedAllocator<int>(1));
+			for (int i = 0; i < 50; i++)
+				first.push_back(i);
+			TaggedIndex copy(first);
+			check(copy.getSize() == 50 && *copy.find(49) == 49,
+				"IndexedList copy constructor");
+			TaggedIndex other(IdentityKey<int>(), hash<int>(),
+				TaggedAllocator<int>(2));
+			// The allocators are unequal and do not propagate, so List
+			// moves each element into a node of its own.  Reusing x's
+			// freed head for the new head makes the two lists start at
+			// the same address, though every other node is new.
+			other.push_back(-1);
+			holdFreed = true;
+			reuseFreed = 1;
+			other = std::move(first);
+			holdFreed = false;
+			for (size_t i = 0; i < heldBlocks.size(); i++)
+				::operator delete(heldBlocks[i]);
+			heldBlocks.clear();
+			for (int i = 0; i < 50; i++)
+				first.push_back(100 + i);
+			bool indexed = other.getSize() == 50;
+			for (int i = 0; i < 50; i++)
+			{
+				TaggedIndex::iterator found = other.find(i);
+				if (static_cast<TaggedIndex::listelem*>(found) == nullptr ||
+						*found != i)
+					indexed = false;
+			}
+			check(indexed && other.erase(25) && !other.contains(25) &&
+				other.getSize() == 49,
+				"IndexedList move assignment between unequal allocators "
+				"rebuilds the index");
+			TaggedIndex same(IdentityKey<int>(), hash<int>(),
+				TaggedAllocator<int>(1));
+			same = std::move(first);
+			check(same.getSize() == 50 && *same.find(120) == 120 &&
+				first.empty() && !first.contains(120),
+				"IndexedList move assignment between equal allocators");
+			TaggedIndex moved(std::move(same));
+			check(moved.getSize() == 50 && *moved.find(149) == 149 &&
+				same.empty(), "IndexedList move constructor");
+			check(is_nothrow_move_constructible<TaggedIndex>::value,
+				"IndexedList's move constructor is noexcept");
+		}
+		check(liveAllocations == allocated, "IndexedList frees every node");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the IndexedList tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testCache
+//
+//	Description:	Test driver for the LRU and CLOCK caches: hits,
+//						misses, eviction order, the second chance, a put
+//						that throws, and move assignment between unequal
+//						allocators.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the LRUCache and ClockCache classes
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the LRUCache and ClockCache classes
+//----------------------------------------------------------------------------
+void testCache()
+{
+	try
+	{
+		cout << "Cache Tests" << endl;
+		cout << "===========" << endl;
+		int allocated = liveAllocations;
+		{
+			LRUCache<int, string> lru(2);
+			string value;
+			lru.put(1, "one");
+			lru.put(2, "two");
+			check(lru.get(1, value) && value == "one" &&
+				!lru.get(3, value) && lru.hits() == 1 && lru.misses() == 1,
+				"LRUCache counts a hit and a miss");
+			// 1 was used last, so 2 is the one to go.
+			lru.put(3, "three");
+			check(lru.getSize() == 2 && lru.contains(1) &&
+				!lru.contains(2) && lru.contains(3),
+				"LRUCache evicts the least recently used entry");
+			lru.put(1, "uno");
+			lru.put(4, "four");
+			check(lru.get(1, value) && value == "uno" && !lru.contains(3),
+				"LRUCache put replaces a value and refreshes it");
+			check(lru.erase(1) && !lru.erase(1) && lru.getSize() == 1,
+				"LRUCache erase");
+			bool threw = false;
+			try
+			{
+				LRUCache<int, string> none(0);
+			}
+			catch (const out_of_range&)
+			{
+				threw = true;
+			}
+			check(threw, "LRUCache refuses a capacity of 0");
+
+			ClockCache<int, string> clock(3);
+			clock.put(1, "one");
+			clock.put(2, "two");
+			clock.put(3, "three");
+			check(clock.get(2, value) && value == "two" &&
+				!clock.get(9, value) && clock.hits() == 1 &&
+				clock.misses() == 1, "ClockCache counts a hit and a miss");
+			// The hand is on 1.  2 was hit, so it is passed over once.
+			clock.put(4, "four");
+			check(!clock.contains(1) && clock.contains(2),
+				"ClockCache evicts the first unreferenced entry");
+			clock.put(5, "five");
+			check(!clock.contains(3) && clock.contains(2),
+				"ClockCache gives a referenced entry a second chance");
+			clock.put(6, "six");
+			check(!clock.contains(4) && clock.contains(2) &&
+				clock.contains(5) && clock.contains(6),
+				"ClockCache clears the bit it passed over");
+			clock.get(2, value);
+			clock.get(5, value);
+			clock.get(6, value);
+			clock.put(7, "seven");
+			// The hand is on 5, after 4, so 5 goes once every bit is
+			// cleared.
+			check(clock.getSize() == 3 && !clock.contains(5) &&
+				clock.contains(2) && clock.contains(6) && clock.contains(7),
+				"ClockCache evicts where the hand started when every "
+				"entry is referenced");
+
+			typedef ClockCache<int, int, hash<int>,
+				TaggedAllocator<pair<int, int> > > TaggedClock;
+			TaggedClock full(3, hash<int>(),
+				TaggedAllocator<pair<int, int> >(1));
+			full.put(1, 10);
+			full.put(2, 20);
+			full.put(3, 30);
+			threw = false;
+			allocationsLeft = 0;
+			try
+			{
+				full.put(4, 40);
+			}
+			catch (const bad_alloc&)
+			{
+				threw = true;
+			}
+			allocationsLeft = -1;
+			check(threw && full.getSize() == 3 && full.contains(1) &&
+				!full.contains(4), "ClockCache put that throws loses no "
+				"entry");
+
+			// The allocators are unequal and do not propagate, so the
+			// entries move into new nodes and the hand must follow them.
+			// Holding the freed nodes keeps a stale hand from faulting.
+			full.put(4, 40);
+			TaggedClock other(3, hash<int>(),
+				TaggedAllocator<pair<int, int> >(2));
+			holdFreed = true;
+			other = std::move(full);
+			other.put(5, 50);
+			other.put(6, 60);
+			bool moved = other.getSize() == 3 && !other.contains(2) &&
+				!other.contains(3) && other.contains(4) &&
+				other.contains(5) && other.contains(6) && full.empty();
+			holdFreed = false;
+			for (size_t i = 0; i < heldBlocks.size(); i++)
+				::operator delete(heldBlocks[i]);
+			heldBlocks.clear();
+			check(moved, "ClockCache move assignment between unequal "
+				"allocators keeps the hand");
+			full.put(7, 70);
+			check(full.getSize() == 1 && full.contains(7),
+				"ClockCache can be used after it is moved from");
+		}
+		check(liveAllocations == allocated, "The caches free every node");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the cache tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testScheduler
+//
+//	Description:	Test driver for the RoundRobinScheduler: weighted
+//						shares under deficit accounting, busy items, the
+//						skipping of rounds spent in debt, and run().
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the RoundRobinScheduler class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the RoundRobinScheduler class
+//----------------------------------------------------------------------------
+void testScheduler()
+{
+	try
+	{
+		cout << "RoundRobinScheduler Tests" << endl;
+		cout << "=========================" << endl;
+		typedef RoundRobinScheduler<int> Scheduler;
+		Scheduler weighted;
+		Scheduler::handle h;
+		weighted.add(0, 1);
+		weighted.add(1, 2);
+		weighted.add(2, 3);
+		int turns[3] = { 0, 0, 0 };
+		for (int i = 0; i < 600; i++)
+		{
+			weighted.try_acquire(h);
+			turns[Scheduler::item(h)]++;
+			weighted.release(h);
+		}
+		cout << "turns for weights 1, 2, 3: " << turns[0] << " " <<
+			turns[1] << " " << turns[2] << endl;
+		check(turns[0] == 100 && turns[1] == 200 && turns[2] == 300,
+			"RoundRobinScheduler shares turns in proportion to weight");
+
+		// Equal weights but unequal costs: the deficit evens out the cost
+		// each is charged, not the number of turns.
+		Scheduler costly;
+		costly.add(0);
+		costly.add(1);
+		long charged[2] = { 0, 0 };
+		for (int i = 0; i < 400; i++)
+		{
+			costly.try_acquire(h);
+			unsigned cost = Scheduler::item(h) == 0 ? 3 : 1;
+			charged[Scheduler::item(h)] += cost;
+			costly.release(h, cost);
+		}
+		check(charged[0] - charged[1] <= 3 && charged[1] - charged[0] <= 3,
+			"RoundRobinScheduler shares cost, not turns");
+
+		// Both items are charged far more than their weight.  Working
+		// the debt off a round at a time would take 10^8 laps;
+		// skip_rounds() credits them in one step, in proportion.
+		Scheduler indebted;
+		indebted.add(0, 1);
+		indebted.add(1, 3);
+		indebted.try_acquire(h);
+		indebted.release(h, 100000000);
+		indebted.try_acquire(h);
+		bool second = Scheduler::item(h) == 1;
+		indebted.release(h, 300000000);
+		int after[2] = { 0, 0 };
+		for (int i = 0; i < 400; i++)
+		{
+			indebted.try_acquire(h);
+			after[Scheduler::item(h)]++;
+			indebted.release(h);
+		}
+		check(second && after[0] == 100 && after[1] == 300,
+			"RoundRobinScheduler skips rounds in debt and keeps the "
+			"weights");
+
+		Scheduler busy;
+		Scheduler::handle first, next, none;
+		busy.add(0);
+		busy.add(1);
+		check(busy.try_acquire(first) && busy.try_acquire(next) &&
+			first != next && !busy.try_acquire(none),
+			"RoundRobinScheduler does not hand out a busy item");
+		busy.remove(first);
+		check(busy.getSize() == 2, "RoundRobinScheduler keeps a busy item "
+			"removed until it is released");
+		busy.release(first);
+		busy.release(next);
+		check(busy.getSize() == 1 && busy.try_acquire(none) &&
+			Scheduler::item(none) == 1,
+			"RoundRobinScheduler drops the removed item on release");
+		busy.release(none);
+		bool threw = false;
+		try
+		{
+			busy.add(2, 0);
+		}
+		catch (const out_of_range&)
+		{
+			threw = true;
+		}
+		check(threw, "RoundRobinScheduler refuses a weight of 0");
+
+		// Each item asks to be removed after its tenth run, so run()
+		// ends once every item has had ten.
+		Scheduler pool;
+		vector<int> runs(8, 0);
+		for (int i = 0; i < 8; i++)
+			pool.add(i, 1 + i % 3);
+		pool.run(3, [&runs](int& item) { return ++runs[item] < 10; });
+		check(pool.empty() && count(runs.begin(), runs.end(), 10) == 8,
+			"RoundRobinScheduler run works each item until it is removed");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the RoundRobinScheduler tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testWorkStealing
+//
+//	Description:	Test driver for the Chase-Lev WorkStealingDeque and
+//						the WorkStealingPool: an owner pushing and popping
+//						while thieves steal must hand out every item
+//						exactly once, and the pool must run every task it
+//						is given.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the WorkStealingDeque and
+//						WorkStealingPool classes
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the WorkStealingDeque and WorkStealingPool
+//						classes
+//----------------------------------------------------------------------------
+void testWorkStealing()
+{
+	try
+	{
+		cout << "Work Stealing Tests" << endl;
+		cout << "===================" << endl;
+		WorkStealingDeque<int> deque(2);
+		for (int i = 0; i < 5; i++)
+			deque.push_back(i);
+		check(deque.getSize() == 5 && deque.capacity() == 8,
+			"WorkStealingDeque grows past its capacity");
+		check(deque.pop_back() == 4 && deque.pop_front() == 0 &&
+			deque.pop_back() == 3 && deque.pop_front() == 1 &&
+			deque.pop_back() == 2 && deque.empty(),
+			"WorkStealingDeque pops the back and steals the front");
+		bool threw = false;
+		try
+		{
+			deque.pop_back();
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(threw, "WorkStealingDeque pop_back on an empty deque throws");
+
+		// The owner pushes, and now and then pops, while three thieves
+		// steal.  A small first ring makes the owner grow it under them.
+		const int items = 20000, thieves = 3;
+		WorkStealingDeque<int> shared(4);
+		vector<vector<int> > taken(thieves + 1);
+		atomic<bool> done(false);
+		atomic<int> ready(0);
+		vector<thread> threads;
+		for (int t = 1; t <= thieves; t++)
+			threads.push_back(thread([&shared, &taken, &done, &ready, t]()
+			{
+				int value;
+				ready++;
+				while (!done.load() || !shared.empty())
+					if (shared.try_pop_front(value))
+						taken[t].push_back(value);
+			}));
+		while (ready.load() < thieves)
+			this_thread::yield();
+		int value;
+		for (int i = 0; i < items; i++)
+		{
+			shared.push_back(i);
+			if (i % 3 == 0 && shared.try_pop_back(value))
+				taken[0].push_back(value);
+			if (i % 64 == 0)
+				this_thread::yield(); // let the thieves in on one core
+		}
+		while (!shared.empty())
+			if (shared.try_pop_back(value))
+				taken[0].push_back(value);
+		done = true;
+		for (size_t t = 0; t < threads.size(); t++)
+			threads[t].join();
+		vector<int> all;
+		for (size_t t = 0; t < taken.size(); t++)
+			all.insert(all.end(), taken[t].begin(), taken[t].end());
+		sort(all.begin(), all.end());
+		bool once = all.size() == static_cast<size_t>(items);
+		for (size_t i = 0; once && i < all.size(); i++)
+			once = all[i] == static_cast<int>(i);
+		cout << "taken by the owner: " << taken[0].size() << " of " <<
+			items << endl;
+		check(once, "WorkStealingDeque hands out every item exactly once");
+
+		// Each outer task submits more from inside a worker, so they go
+		// on that worker's deque and the others must steal them.
+		const int outer = 200, inner = 10;
+		vector<atomic<int> > runs(outer * (inner + 1));
+		for (size_t i = 0; i < runs.size(); i++)
+			runs[i] = 0;
+		{
+			WorkStealingPool pool(4);
+			for (int i = 0; i < outer; i++)
+				pool.submit([&pool, &runs, i, inner]()
+				{
+					runs[i * (inner + 1)]++;
+					for (int j = 1; j <= inner; j++)
+						pool.submit([&runs, i, j, inner]()
+							{ runs[i * (inner + 1) + j]++; });
+				});
+			pool.wait();
+			bool ranOnce = true;
+			for (size_t i = 0; i < runs.size(); i++)
+				if (runs[i].load() != 1)
+					ranOnce = false;
+			check(ranOnce, "WorkStealingPool runs every task exactly once");
+
+			pool.submit([]() { throw runtime_error("task failed"); });
+			threw = false;
+			try
+			{
+				pool.wait();
+			}
+			catch (const runtime_error&)
+			{
+				threw = true;
+			}
+			check(threw, "WorkStealingPool wait rethrows a task's exception");
+		}
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the work stealing tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testPriority
+//
+//	Description:	Test driver for the PriorityQueue and BucketQueue:
+//						pop order against a sorted reference, and the
+//						BucketQueue's levels either side of each 64-bit
+//						word of its bitmap.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the PriorityQueue and BucketQueue
+//						classes
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the PriorityQueue and BucketQueue classes
+//----------------------------------------------------------------------------
+void testPriority()
+{
+	try
+	{
+		cout << "Priority Queue Tests" << endl;
+		cout << "====================" << endl;
+		PriorityQueue<int> smallest;
+		PriorityQueue<int, greater<int>, 2> largest((greater<int>()));
+		PriorityQueue<int, less<int>, 3> ternary;
+		vector<int> reference;
+		unsigned seed = 4242;
+		for (int i = 0; i < 1000; i++)
+		{
+			seed = seed * 1103515245u + 12345u;
+			int value = static_cast<int>(seed >> 8) % 500; // with repeats
+			smallest.push(value);
+			largest.push(value);
+			ternary.emplace(value);
+			reference.push_back(value);
+		}
+		sort(reference.begin(), reference.end());
+		vector<int> up, down, third;
+		while (!smallest.empty())
+			up.push_back(smallest.pop());
+		while (!largest.empty())
+			down.push_back(largest.pop());
+		while (!ternary.empty())
+			third.push_back(ternary.pop());
+		check(up == reference && third == reference,
+			"PriorityQueue pops in sorted order");
+		reverse(reference.begin(), reference.end());
+		check(down == reference,
+			"PriorityQueue with greater<int> pops largest first");
+		bool threw = false;
+		try
+		{
+			smallest.pop();
+		}
+		catch (const runtime_error&)
+		{
+			threw = true;
+		}
+		check(threw, "PriorityQueue pop on an empty queue throws");
+
+		// 200 levels take four words of marks; the top word is partial.
+		const unsigned levels = 200;
+		BucketQueue<int> buckets(levels);
+		bool alone = true;
+		for (unsigned p = 0; p < levels; p++)
+		{
+			buckets.push(static_cast<int>(p), p);
+			if (buckets.frontPriority() != p ||
+					buckets.pop() != static_cast<int>(p) || !buckets.empty())
+				alone = false;
+		}
+		check(alone, "BucketQueue finds each level on its own");
+
+		// Each element is its priority * 1000 plus the order it went in,
+		// so a stable sort of the values is the order it must come out.
+		const unsigned edges[] = { 0, 1, 62, 63, 64, 65, 127, 128,
+			levels - 1 };
+		const unsigned edgeCount = sizeof(edges) / sizeof(edges[0]);
+		vector<int> expected;
+		for (int i = 0; i < 300; i++)
+		{
+			seed = seed * 1103515245u + 12345u;
+			unsigned p = edges[(seed >> 8) % edgeCount];
+			if (i % 3 == 0)
+				p = (seed >> 16) % levels;
+			int value = static_cast<int>(p) * 1000 + i;
+			buckets.push(value, p);
+			expected.push_back(value);
+		}
+		sort(expected.begin(), expected.end());
+		vector<int> popped;
+		bool priorities = true;
+		while (!buckets.empty())
+		{
+			unsigned p = buckets.frontPriority();
+			int value = buckets.pop();
+			if (static_cast<unsigned>(value / 1000) != p)
+				priorities = false;
+			popped.push_back(value);
+		}
+		check(priorities && popped == expected,
+			"BucketQueue pops by priority, oldest first, across words");
+
+		buckets.push(1, levels - 1);
+		buckets.push(2, 64);
+		buckets.push(3, 63);
+		buckets.push(4, 0);
+		check(buckets.frontPriority() == 0 && buckets.pop() == 4 &&
+			buckets.pop() == 3 && buckets.pop() == 2 &&
+			buckets.frontPriority() == levels - 1 && buckets.pop() == 1,
+			"BucketQueue levels 0, 63, 64 and the top");
+		buckets.push(5, 64);
+		buckets.push(6, 3);
+		buckets.release();
+		buckets.push(7, 128);
+		check(buckets.getSize() == 1 && buckets.frontPriority() == 128,
+			"BucketQueue release clears the marks");
+		threw = false;
+		try
+		{
+			buckets.push(8, levels);
+		}
+		catch (const out_of_range&)
+		{
+			threw = true;
+		}
+		check(threw && buckets.getSize() == 1,
+			"BucketQueue refuses a priority past the top level");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the priority queue tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		testBlocking
+//
+//	Description:	Test driver for the BlockingQueue: timeouts that
+//						saturate, close() waking blocked threads on both
+//						ends, and push_range keeping to the capacity.
+//
+//	Programmer:		David Landry
+//	
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			Various methods of the BlockingQueue class
+//
+//	Called by:		main
+//
+//	Input:			Prompts to continue.
+//
+//	Output:			Data from the BlockingQueue class
+//----------------------------------------------------------------------------
+void testBlocking()
+{
+	try
+	{
+		cout << "BlockingQueue Tests" << endl;
+		cout << "===================" << endl;
+		BlockingQueue<int> queue(2);
+		int value = 0;
+		check(queue.try_push(1) && queue.push_for(2, chrono::seconds(1)) &&
+			!queue.try_push(3) &&
+			!queue.push_for(3, chrono::milliseconds(10)) &&
+			queue.getSize() == 2, "BlockingQueue keeps to its capacity");
+		check(queue.pop_for(value, chrono::hours::max()) && value == 1 &&
+			queue.push_for(3, chrono::nanoseconds::max()) &&
+			queue.getSize() == 2,
+			"BlockingQueue saturates a timeout of duration::max()");
+		check(queue.try_pop(value) && value == 2 &&
+			queue.pop_for(value, chrono::nanoseconds::max()) &&
+			value == 3 && !queue.try_pop(value) &&
+			!queue.pop_for(value, chrono::milliseconds(10)),
+			"BlockingQueue pop_for and try_pop");
+
+		// A pop_for that can wait forever must still see a later push.
+		int late = 0;
+		bool gotLate = false;
+		thread waiter([&queue, &late, &gotLate]()
+			{ gotLate = queue.pop_for(late, chrono::hours::max()); });
+		this_thread::sleep_for(chrono::milliseconds(20));
+		queue.push(7);
+		waiter.join();
+		check(gotLate && late == 7,
+			"BlockingQueue pop_for(hours::max()) wakes for a push");
+
+		// One thread blocks popping an empty queue, another pushing a
+		// full one; close() must let both go.
+		BlockingQueue<int> empty, full(1);
+		full.push(1);
+		bool popped = true, pushed = true;
+		thread popper([&empty, &popped]()
+			{
+				int out;
+				popped = empty.pop_wait(out);
+			});
+		thread pusher([&full, &pushed]() { pushed = full.push(2); });
+		this_thread::sleep_for(chrono::milliseconds(20));
+		empty.close();
+		full.close();
+		popper.join();
+		pusher.join();
+		check(!popped && !pushed && empty.closed() && full.closed(),
+			"BlockingQueue close wakes blocked poppers and pushers");
+		check(full.pop_wait(value) && value == 1 && !full.pop_wait(value) &&
+			!full.push(3), "BlockingQueue drains after close, then stops");
+
+		// push_range blocks on a full queue rather than overfilling it.
+		BlockingQueue<int> bounded(4);
+		vector<int> source;
+		for (int i = 0; i < 50; i++)
+			source.push_back(i);
+		size_t added = 0;
+		thread producer([&bounded, &source, &added]()
+			{ added = bounded.push_range(source.begin(), source.end()); });
+		vector<int> received;
+		bool bounded4 = true;
+		while (received.size() < source.size())
+		{
+			this_thread::yield();
+			if (bounded.getSize() > bounded.capacity())
+				bounded4 = false;
+			if (received.size() % 2 == 0)
+			{
+				bounded.pop_wait(value);
+				received.push_back(value);
+			}
+			else
+			{
+				int batch[3];
+				size_t k = bounded.pop_batch(batch, 3);
+				received.insert(received.end(), batch, batch + k);
+			}
+		}
+		producer.join();
+		check(bounded4 && added == source.size() && received == source,
+			"BlockingQueue push_range keeps to the capacity, in order");
+		pressEnter();
+	}
+	catch (const exception& e)
+	{
+		cout << e.what();
+		check(false, "no exception escapes the BlockingQueue tests");
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		check
+//
+//	Description:	Records the result of one check.  A failed check is
+//						reported on cerr and counted, so that main() can
+//						return EXIT_FAILURE.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		bool passed- Whether the check passed.
+//					const string& what- What was checked.
+//
+//	Returns:		None
+//
+//	Calls:			None
+//
+//	Called by:		The test functions
+//
+//	Input:			None
+//
+//	Output:			The name of a failed check.
+//----------------------------------------------------------------------------
+void check(bool passed, const string& what)
+{
+	if (!passed)
+	{
+		cerr << "FAILED: " << what << endl;
+		failures++;
+	}
+}
+
+//----------------------------------------------------------------------------
+//	Function:		contents
+//
+//	Description:	Returns what operator<< prints for a List or Queue,
+//						without the closing line break, e.g. "(A,B,C)".
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		const Container& x- The List or Queue.
+//
+//	Returns:		The elements in parentheses, separated by commas.
+//
+//	Calls:			operator<<
+//
+//	Called by:		The test functions
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+template<class Container>
+string contents(const Container& x)
+{
+	ostringstream sout;
+	sout << x;
+	string text = sout.str();
+	if (!text.empty() && text[text.size() - 1] == '\n')
+		text.erase(text.size() - 1);
+	return text;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		pressEnter
+//
+//	Description:	Prompts for Enter, then clears the console.  Does
+//						nothing when the tester is running unattended.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			waitForEnter(), clearScreen()
+//
+//	Called by:		The test functions
+//
+//	Input:			Enter.
+//
+//	Output:			The prompt.
+//----------------------------------------------------------------------------
+void pressEnter()
+{
+	if (!interactive)
+		return;
+	cout << "Press \"Enter\" to continue.";
+	waitForEnter();
+	clearScreen();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		nextLine
+//
+//	Description:	Ends a line of output.  When interactive, the line
+//						ends with the Enter the user presses to go on.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			waitForEnter()
+//
+//	Called by:		testCDLL, testExceptCDLL
+//
+//	Input:			Enter.
+//
+//	Output:			A line break when unattended.
+//----------------------------------------------------------------------------
+void nextLine()
+{
+	if (interactive)
+		waitForEnter();
+	else
+		cout << endl;
+}
+
+//----------------------------------------------------------------------------
+//	Function:		waitForEnter
+//
+//	Description:	Waits for the user to press Enter.  Only called when
+//						the tester is interactive.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.1
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			None
+//
+//	Called by:		pressEnter, nextLine
+//
+//	Input:			Enter.
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+void waitForEnter()
+{
+	cin.get();
+}
+
+//----------------------------------------------------------------------------
+//	Function:		clearScreen
+//
+//	Description:	Clears the console.  Only called when the tester is
+//						interactive.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.1
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		None
+//
+//	Calls:			None
+//
+//	Called by:		pressEnter
+//
+//	Input:			None
+//
+//	Output:			None
+//----------------------------------------------------------------------------
+void clearScreen()
+{
+	system("CLS");
+}
+
+//----------------------------------------------------------------------------
+//	Function:		readHops
+//
+//	Description:	Reads how many iterator hops to test.  When the tester
+//						is running unattended it uses a fixed count that
+//						wraps around the list at least once.
+//
+//	Programmer:		David Landry
+//
+//	Version:		1.0
+//
+//	Date:			10/17/2026
+//
+//	Environment:	Hardware:
+//						Intel Core i7 processor
+//					Software:
+//						PC powered by Windows 10
+//						Compiled using Microsoft Visual Studio Community 2013.
+//
+//	Parameters:		None
+//
+//	Returns:		The number of hops.
+//
+//	Calls:			None
+//
+//	Called by:		testCDLL
+//
+//	Input:			The number of hops.
+//
+//	Output:			The fixed count when unattended.
+//----------------------------------------------------------------------------
+int readHops()
+{
+	int hops = 0;
+	if (interactive)
+		(cin >> hops).get();
+	else
+	{
+		hops = 12;
+		cout << hops << endl;
+	}
+	return hops;
 }
\ No newline at end of file
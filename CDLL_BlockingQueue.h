@@ -0,0 +1,501 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_BlockingQueue.h
+//
+//	Class:			BlockingQueue
+//
+//	Title:			Blocking Queue with Timeouts and Backpressure
+//
+//	Description:	This file contains the class definitions for the
+//						BlockingQueue Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class BlockingQueue:
+//		Description:
+//			A thread-safe FIFO queue around a Queue, for consumers that
+//				would otherwise poll.  A consumer that finds it empty
+//				sleeps on a condition variable until an element arrives,
+//				the queue is closed, or its timeout runs out.  With a
+//				capacity, a producer that finds it full sleeps the same way
+//				until there is room, so a fast producer is held back to the
+//				consumers' pace instead of growing the queue without bound.
+//
+//			Each side counts its sleepers, so a push or pop only signals
+//				when someone is waiting, and a batch of k elements wakes at
+//				most k sleepers.  close() wakes everyone: producers then
+//				fail, and consumers drain what is left and then fail.
+//
+//		Properties:
+//			Queue<DataType, Alloc, StaticDispatch> m_queue- The elements.
+//			mutex m_lock-	Guards every other property.
+//			condition_variable m_notEmpty- Consumers sleep here.
+//			condition_variable m_notFull- Producers sleep here.
+//			unsigned m_capacity- The most elements the queue holds, or 0
+//							for no bound.
+//			unsigned m_waitingPop, m_waitingPush- The number of sleeping
+//							consumers and producers.
+//			bool m_closed-	Set by close().
+//
+//		Methods:
+//			explicit BlockingQueue(unsigned capacity, const Alloc& alloc)-
+//				Constructor.  A capacity of 0, the default, is unbounded.
+//			bool push(const DataType& datum), bool push(DataType&& datum)-
+//				Adds an element at the back, waiting for room.  Returns
+//				false, without adding it, if the queue is closed.
+//			bool push_for(const DataType& datum, duration timeout)- Like
+//				push(), but returns false if there is still no room after
+//				timeout.
+//			bool try_push(const DataType& datum)- Like push(), but returns
+//				false at once if the queue is full.
+//			size_t push_range(InputIt first, InputIt last)- Adds the
+//				elements in [first, last), as many at a time as there is
+//				room for, and wakes one consumer per element.  Returns the
+//				number added, which is short only if the queue was closed.
+//			bool pop_wait(DataType& out)- Moves the front element into out,
+//				waiting for one.  Returns false once the queue is closed and
+//				empty.
+//			bool pop_for(DataType& out, duration timeout)- Like pop_wait(),
+//				but also returns false if the queue is still empty after
+//				timeout.
+//			bool try_pop(DataType& out)- Like pop_wait(), but returns false
+//				at once if the queue is empty.
+//			size_t pop_batch(OutputIt out, size_t n)- Waits for at least
+//				one element, then moves up to n into out in one lock.
+//				Returns the number moved; 0 once closed and empty.
+//			void close()- Refuses further pushes and wakes every sleeper.
+//			bool closed() const- Whether close() has been called.
+//			unsigned getSize() const, bool empty() const- The number of
+//				elements, and whether there are none.
+//			unsigned capacity() const- The bound, or 0.
+//			bool push_until(T&& datum, time_point until),
+//				bool pop_until(DataType& out, time_point until)- The work
+//				behind every push and pop: until is time_point::min() for
+//				the try_ versions and time_point::max() for no timeout.
+//				(private)
+//			static time_point deadline(duration timeout)- now plus
+//				timeout, saturating at time_point::max().  (private)
+//			bool full() const- Whether a push must wait.  (private)
+//			bool wait_for_room(unique_lock& lock, deadline)- Sleeps until
+//				there is room or the queue is closed.  (private)
+//			bool wait_for_data(unique_lock& lock, deadline)- Sleeps until
+//				there is an element or the queue is closed.  (private)
+//			void wake(condition_variable& cv, unsigned waiting, size_t k)-
+//				Wakes up to k of the waiting sleepers.  (private)
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_BLOCKING_QUEUE_H
+#define DL_CDLL_BLOCKING_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include "CDLL_Queue.h"
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class DataType, class Alloc = allocator<DataType> >
+	class BlockingQueue
+	{
+		typedef chrono::steady_clock clock;
+	public:
+		explicit BlockingQueue(unsigned capacity = 0,
+			const Alloc& alloc = Alloc())
+			: m_queue(alloc), m_capacity(capacity), m_waitingPop(0),
+			m_waitingPush(0), m_closed(false) {}
+
+		bool push(const DataType& datum)
+			{ return push_until(datum, clock::time_point::max()); }
+		bool push(DataType&& datum)
+			{ return push_until(std::move(datum), clock::time_point::max()); }
+		template<class Rep, class Period>
+		bool push_for(const DataType& datum,
+			const chrono::duration<Rep, Period>& timeout)
+			{ return push_until(datum, deadline(timeout)); }
+		template<class Rep, class Period>
+		bool push_for(DataType&& datum,
+			const chrono::duration<Rep, Period>& timeout)
+			{ return push_until(std::move(datum), deadline(timeout)); }
+		bool try_push(const DataType& datum)
+			{ return push_until(datum, clock::time_point::min()); }
+		bool try_push(DataType&& datum)
+			{ return push_until(std::move(datum), clock::time_point::min()); }
+		template<class InputIt>
+		size_t push_range(InputIt first, InputIt last);
+
+		bool pop_wait(DataType& out)
+			{ return pop_until(out, clock::time_point::max()); }
+		template<class Rep, class Period>
+		bool pop_for(DataType& out,
+			const chrono::duration<Rep, Period>& timeout)
+			{ return pop_until(out, deadline(timeout)); }
+		bool try_pop(DataType& out)
+			{ return pop_until(out, clock::time_point::min()); }
+		template<class OutputIt>
+		size_t pop_batch(OutputIt out, size_t n);
+
+		void close();
+		bool closed() const
+		{
+			lock_guard<mutex> lock(m_lock);
+			return m_closed;
+		}
+		unsigned getSize() const
+		{
+			lock_guard<mutex> lock(m_lock);
+			return m_queue.getSize();
+		}
+		bool empty() const { return getSize() == 0; }
+		unsigned capacity() const { return m_capacity; }
+	private:
+		BlockingQueue(const BlockingQueue&);
+		BlockingQueue& operator=(const BlockingQueue&);
+
+		template<class Rep, class Period>
+		static clock::time_point deadline(
+			const chrono::duration<Rep, Period>& timeout)
+		{
+			// Compared in floating point so that a huge timeout such as
+			// hours::max() saturates instead of overflowing the cast.
+			clock::time_point now = clock::now();
+			if (timeout <= timeout.zero())
+				return now;
+			if (timeout >= chrono::duration<double>(
+					clock::time_point::max() - now))
+				return clock::time_point::max();
+			return now + chrono::duration_cast<clock::duration>(timeout);
+		}
+		bool full() const
+			{ return m_capacity != 0 && m_queue.getSize() >= m_capacity; }
+		template<class T>
+		bool push_until(T&& datum, clock::time_point until);
+		bool pop_until(DataType& out, clock::time_point until);
+		bool wait_for_room(unique_lock<mutex>& lock,
+			clock::time_point until);
+		bool wait_for_data(unique_lock<mutex>& lock,
+			clock::time_point until);
+		static void wake(condition_variable& cv, unsigned waiting,
+			size_t k);
+
+		// Properties:
+		Queue<DataType, Alloc, StaticDispatch> m_queue;
+		mutable mutex m_lock;
+		condition_variable m_notEmpty;
+		condition_variable m_notFull;
+		unsigned m_capacity; // 0 for no bound
+		unsigned m_waitingPop;
+		unsigned m_waitingPush;
+		bool m_closed;
+	}; // End BlockingQueue class declarations.
+
+	// Definitions for the BlockingQueue class now follow.
+
+	//------------------------------------------------------------------------
+	//	Method:			bool BlockingQueue<DataType>::push_until(T&& datum,
+	//						clock::time_point until)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Waits until there is room, then adds datum at the
+	//						back and wakes one sleeping consumer.  The
+	//						consumer is signalled after the lock is
+	//						released, so it does not wake only to block on
+	//						the mutex.
+	//	Parameters:		T&& datum- the element, copied or moved in.
+	//					clock::time_point until- when to give up waiting;
+	//						time_point::min() never waits and
+	//						time_point::max() waits for ever.
+	//	Returns:		true if datum was added; false if the queue was
+	//						closed or still full at until.
+	//	Calls:			wait_for_room(); wake()
+	//					Queue's push method
+	//	Called by:		push(); push_for(); try_push()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  The queue is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	template <class T>
+	bool BlockingQueue<DataType, Alloc>::push_until(T&& datum,
+		clock::time_point until)
+	{
+		unique_lock<mutex> lock(m_lock);
+		if (!wait_for_room(lock, until))
+			return false;
+		m_queue.push(std::forward<T>(datum));
+		unsigned waiting = m_waitingPop;
+		lock.unlock();
+		wake(m_notEmpty, waiting, 1);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			size_t BlockingQueue<DataType>::push_range
+	//						(InputIt first, InputIt last)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Adds the elements in [first, last) at the back.
+	//						Each time the lock is held it adds as many as
+	//						there is room for, then wakes up to that many
+	//						consumers, rather than one lock and one signal
+	//						per element.
+	//	Parameters:		InputIt first- the first element to add.
+	//					InputIt last- one past the last element to add.
+	//	Returns:		The number of elements added.  It is short of the
+	//						whole range only if the queue was closed.
+	//	Calls:			wait_for_room(); full(); wake()
+	//					Queue's push method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  The elements already added stay.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	template <class InputIt>
+	size_t BlockingQueue<DataType, Alloc>::push_range(InputIt first,
+		InputIt last)
+	{
+		size_t added = 0;
+		while (first != last)
+		{
+			unique_lock<mutex> lock(m_lock);
+			if (!wait_for_room(lock, clock::time_point::max()))
+				break;
+			size_t k = 0;
+			for (; first != last && !full(); ++first, k++)
+				m_queue.push(*first);
+			unsigned waiting = m_waitingPop;
+			lock.unlock();
+			wake(m_notEmpty, waiting, k);
+			added += k;
+		}
+		return added;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool BlockingQueue<DataType>::pop_until
+	//						(DataType& out, clock::time_point until)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Waits until there is an element, then moves the
+	//						front one into out and wakes one sleeping
+	//						producer.
+	//	Parameters:		DataType& out- where the front element is moved.
+	//					clock::time_point until- when to give up waiting,
+	//						as for push_until().
+	//	Returns:		true if an element was moved into out; false if the
+	//						queue was closed and empty, or still empty at
+	//						until.
+	//	Calls:			wait_for_data(); wake()
+	//					Queue's pop method
+	//	Called by:		pop_wait(); pop_for(); try_pop()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool BlockingQueue<DataType, Alloc>::pop_until(DataType& out,
+		clock::time_point until)
+	{
+		unique_lock<mutex> lock(m_lock);
+		if (!wait_for_data(lock, until))
+			return false;
+		out = m_queue.pop();
+		unsigned waiting = m_waitingPush;
+		lock.unlock();
+		wake(m_notFull, waiting, 1);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			size_t BlockingQueue<DataType>::pop_batch
+	//						(OutputIt out, size_t n)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Waits for at least one element, then moves up to n
+	//						from the front into out while holding the lock
+	//						once, and wakes up to that many producers.
+	//	Parameters:		OutputIt out- where the elements are written.
+	//					size_t n- the most elements to move.
+	//	Returns:		The number of elements moved; 0 if the queue was
+	//						closed and empty, or n was 0.
+	//	Calls:			wait_for_data(); wake()
+	//					Queue's pop_n method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever writing through out throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	template <class OutputIt>
+	size_t BlockingQueue<DataType, Alloc>::pop_batch(OutputIt out, size_t n)
+	{
+		if (n == 0)
+			return 0;
+		unique_lock<mutex> lock(m_lock);
+		if (!wait_for_data(lock, clock::time_point::max()))
+			return 0;
+		size_t before = m_queue.getSize();
+		m_queue.pop_n(out, n);
+		size_t k = before - m_queue.getSize();
+		unsigned waiting = m_waitingPush;
+		lock.unlock();
+		wake(m_notFull, waiting, k);
+		return k;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void BlockingQueue<DataType>::close()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Marks the queue closed and wakes every sleeping
+	//						producer and consumer.  Pushes fail from now on;
+	//						pops go on until the queue is empty.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	void BlockingQueue<DataType, Alloc>::close()
+	{
+		{
+			lock_guard<mutex> lock(m_lock);
+			m_closed = true;
+		}
+		m_notEmpty.notify_all();
+		m_notFull.notify_all();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool BlockingQueue<DataType>::wait_for_room
+	//						(unique_lock<mutex>& lock,
+	//						clock::time_point until)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Sleeps on m_notFull, counted in m_waitingPush, while
+	//						the queue is full and open and until has not
+	//						passed.
+	//	Parameters:		unique_lock<mutex>& lock- holds m_lock.
+	//					clock::time_point until- when to give up.
+	//	Returns:		true if there is room and the queue is open.
+	//	Calls:			full()
+	//	Called by:		push_until(); push_range()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool BlockingQueue<DataType, Alloc>::wait_for_room(
+		unique_lock<mutex>& lock, clock::time_point until)
+	{
+		while (!m_closed && full())
+		{
+			if (until == clock::time_point::min())
+				return false;
+			m_waitingPush++;
+			if (until == clock::time_point::max())
+				m_notFull.wait(lock);
+			else if (m_notFull.wait_until(lock, until) == cv_status::timeout)
+			{
+				m_waitingPush--;
+				return !m_closed && !full();
+			}
+			m_waitingPush--;
+		}
+		return !m_closed;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool BlockingQueue<DataType>::wait_for_data
+	//						(unique_lock<mutex>& lock,
+	//						clock::time_point until)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Sleeps on m_notEmpty, counted in m_waitingPop, while
+	//						the queue is empty and open and until has not
+	//						passed.
+	//	Parameters:		unique_lock<mutex>& lock- holds m_lock.
+	//					clock::time_point until- when to give up.
+	//	Returns:		true if there is an element to pop.
+	//	Calls:			Queue's empty method
+	//	Called by:		pop_until(); pop_batch()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool BlockingQueue<DataType, Alloc>::wait_for_data(
+		unique_lock<mutex>& lock, clock::time_point until)
+	{
+		while (!m_closed && m_queue.empty())
+		{
+			if (until == clock::time_point::min())
+				return false;
+			m_waitingPop++;
+			if (until == clock::time_point::max())
+				m_notEmpty.wait(lock);
+			else if (m_notEmpty.wait_until(lock, until)
+				== cv_status::timeout)
+			{
+				m_waitingPop--;
+				return !m_queue.empty();
+			}
+			m_waitingPop--;
+		}
+		return !m_queue.empty();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void BlockingQueue<DataType>::wake
+	//						(condition_variable& cv, unsigned waiting,
+	//						size_t k)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Signals cv for k new elements or slots.  Nothing is
+	//						signalled when no one was waiting, one sleeper
+	//						is woken for one, and all of them are woken
+	//						when k covers every sleeper.
+	//	Parameters:		condition_variable& cv- m_notEmpty or m_notFull.
+	//					unsigned waiting- the sleepers counted under the
+	//						lock.
+	//					size_t k- the number of elements or slots.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		push_until(); push_range(); pop_until();
+	//						pop_batch()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	void BlockingQueue<DataType, Alloc>::wake(condition_variable& cv,
+		unsigned waiting, size_t k)
+	{
+		if (waiting == 0 || k == 0)
+			return;
+		if (k >= waiting)
+			cv.notify_all();
+		else
+			for (; k > 0; k--)
+				cv.notify_one();
+	}
+} // End DL_CDLL namespace.
+
+#endif
@@ -0,0 +1,528 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_Cache.h
+//
+//	Class:			LRUCache
+//					ClockCache
+//
+//	Title:			LRU and CLOCK Caches on the Circular List
+//
+//	Description:	This file contains the class definitions for the
+//						LRUCache and ClockCache Template Classes.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class LRUCache:
+//		Description:
+//			A map from Key to Value holding at most capacity entries.  When
+//				it is full, adding an entry evicts the least recently used
+//				one.  The entries sit on an IndexedList in order of use,
+//				most recent at the front, so a hit is a hash lookup and a
+//				move_to_front(), and eviction is a pop_back().
+//
+//		Properties:
+//			IndexedList<entry, EntryKey, Hash, Alloc> m_list- The entries,
+//							most recently used first.
+//			size_t m_capacity- The most entries the cache holds.
+//			unsigned long long m_hits, m_misses- The get() calls that did
+//							and did not find their key.
+//
+//		Classes and structs contained within:
+//			EntryKey-		Extracts the key from an entry.
+//
+//		Methods:
+//			explicit LRUCache(size_t capacity, const Hash& hash,
+//				const Alloc& alloc)- Constructor.  Throws out_of_range
+//				for a capacity of 0.
+//			bool get(const Key& key, Value& value)- Copies key's value into
+//				value and marks it most recently used.  Returns false, and
+//				leaves value alone, on a miss.
+//			void put(const Key& key, const Value& value)- Adds or replaces
+//				key's value and marks it most recently used, evicting the
+//				least recently used entry if the cache is over capacity.
+//			bool erase(const Key& key)- Removes key.  Returns whether it was
+//				there.
+//			bool contains(const Key& key) const- Whether key is cached.  It
+//				does not count as a use.
+//			unsigned getSize() const, bool empty() const- The number of
+//				entries, and whether there are none.
+//			size_t capacity() const- The most entries the cache holds.
+//			unsigned long long hits() const, misses() const- The get()
+//				counters.
+//			void release()- Empties the cache.  The counters are kept.
+//
+//	Class ClockCache:
+//		Description:
+//			A map from Key to Value holding at most capacity entries, with
+//				CLOCK eviction: each entry has a referenced bit that a hit
+//				sets, and the entries sit on the list's circular next chain
+//				with a hand pointing into it.  To make room, the hand walks
+//				forward, clearing referenced bits, and evicts the first
+//				entry whose bit is already clear.  New entries are linked in
+//				just behind the hand, so they are the last the hand reaches.
+//				A hit only sets a bit; unlike LRUCache it does not relink.
+//
+//		Properties:
+//			IndexedList<entry, EntryKey, Hash, Alloc> m_ring- The entries.
+//			iterator m_hand- The next entry the hand looks at, or iterator()
+//							when the cache is empty.
+//			size_t m_capacity- The most entries the cache holds.
+//			unsigned long long m_hits, m_misses- The get() calls that did
+//							and did not find their key.
+//
+//		Classes and structs contained within:
+//			entry-			One cached key and value.
+//				Properties:
+//						Key key, Value value- The cached pair.
+//						bool referenced- Set by a hit and cleared by the
+//							hand.
+//			EntryKey-		Extracts the key from an entry.
+//
+//		Methods:
+//			As for LRUCache, plus copy and move constructors and assignment
+//				that keep the hand on the same entry.
+//			void evict(iterator keep)- Advances the hand to an unreferenced
+//				entry other than keep and removes it.  (private)
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_CACHE_H
+#define DL_CDLL_CACHE_H
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include "CDLL_IndexedList.h"
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class Key, class Value, class Hash = hash<Key>,
+		class Alloc = allocator<pair<Key, Value> > >
+	class LRUCache
+	{
+		typedef pair<Key, Value> entry;
+		struct EntryKey
+		{
+			const Key& operator()(const entry& x) const { return x.first; }
+		};
+		typedef IndexedList<entry, EntryKey, Hash, Alloc> list_type;
+	public:
+		explicit LRUCache(size_t capacity, const Hash& hash = Hash(),
+			const Alloc& alloc = Alloc());
+
+		bool get(const Key& key, Value& value);
+		void put(const Key& key, const Value& value);
+		bool erase(const Key& key) { return m_list.erase(key); }
+		bool contains(const Key& key) const { return m_list.contains(key); }
+		unsigned getSize() const { return m_list.getSize(); }
+		bool empty() const { return m_list.empty(); }
+		size_t capacity() const { return m_capacity; }
+		unsigned long long hits() const { return m_hits; }
+		unsigned long long misses() const { return m_misses; }
+		void release() { m_list.release(); }
+	private:
+		// Properties:
+		list_type m_list; // most recently used first
+		size_t m_capacity;
+		unsigned long long m_hits, m_misses;
+	};
+
+	template<class Key, class Value, class Hash = hash<Key>,
+		class Alloc = allocator<pair<Key, Value> > >
+	class ClockCache
+	{
+		struct entry
+		{
+			Key key;
+			Value value;
+			bool referenced;
+			entry(const Key& k, const Value& v)
+				: key(k), value(v), referenced(false) {}
+		};
+		struct EntryKey
+		{
+			const Key& operator()(const entry& x) const { return x.key; }
+		};
+		typedef IndexedList<entry, EntryKey, Hash,
+			typename allocator_traits<Alloc>::template rebind_alloc<entry> >
+			list_type;
+		typedef typename list_type::iterator iterator;
+	public:
+		explicit ClockCache(size_t capacity, const Hash& hash = Hash(),
+			const Alloc& alloc = Alloc());
+		ClockCache(const ClockCache& x)
+			: m_ring(x.m_ring), m_capacity(x.m_capacity), m_hits(x.m_hits),
+			m_misses(x.m_misses)
+			{ m_hand = x.empty() ? iterator() : m_ring.find(x.m_hand->key); }
+		ClockCache(ClockCache&& x)
+			: m_ring(std::move(x.m_ring)), m_hand(x.m_hand),
+			m_capacity(x.m_capacity), m_hits(x.m_hits), m_misses(x.m_misses)
+			{ x.m_hand = iterator(); }
+		ClockCache& operator=(const ClockCache& x);
+		ClockCache& operator=(ClockCache&& x);
+
+		bool get(const Key& key, Value& value);
+		void put(const Key& key, const Value& value);
+		bool erase(const Key& key);
+		bool contains(const Key& key) const { return m_ring.contains(key); }
+		unsigned getSize() const { return m_ring.getSize(); }
+		bool empty() const { return m_ring.empty(); }
+		size_t capacity() const { return m_capacity; }
+		unsigned long long hits() const { return m_hits; }
+		unsigned long long misses() const { return m_misses; }
+		void release()
+		{
+			m_ring.release();
+			m_hand = iterator();
+		}
+	private:
+		void evict(iterator keep);
+
+		// Properties:
+		list_type m_ring;
+		iterator m_hand; // the next entry the hand looks at
+		size_t m_capacity;
+		unsigned long long m_hits, m_misses;
+	};
+
+	//------------------------------------------------------------------------
+	//	Method:			LRUCache<Key, Value>::LRUCache(size_t capacity,
+	//						const Hash& hash, const Alloc& alloc)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor.  Sizes the index for capacity entries.
+	//	Parameters:		size_t capacity- the most entries to hold.
+	//					const Hash& hash- hashes the keys.
+	//					const Alloc& alloc- allocates the entries.
+	//	Returns:		None
+	//	Calls:			IndexedList's reserve method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range for a capacity of 0.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	LRUCache<Key, Value, Hash, Alloc>::LRUCache(size_t capacity,
+		const Hash& hash, const Alloc& alloc)
+		: m_list(EntryKey(), hash, alloc), m_capacity(capacity), m_hits(0),
+		m_misses(0)
+	{
+		if (capacity == 0)
+			throw out_of_range("Could not create cache: Bad capacity");
+		m_list.reserve(capacity);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool LRUCache<Key, Value>::get(const Key& key,
+	//						Value& value)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Looks key up.  On a hit, copies its value out and
+	//						moves its entry to the front.
+	//	Parameters:		const Key& key- the key to look up.
+	//					Value& value- receives the value on a hit.
+	//	Returns:		True on a hit.
+	//	Calls:			IndexedList's find and move_to_front methods
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	bool LRUCache<Key, Value, Hash, Alloc>::get(const Key& key, Value& value)
+	{
+		typename list_type::iterator it = m_list.find(key);
+		if (it == typename list_type::iterator())
+		{
+			m_misses++;
+			return false;
+		}
+		value = it->second;
+		m_list.move_to_front(it);
+		m_hits++;
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void LRUCache<Key, Value>::put(const Key& key,
+	//						const Value& value)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Replaces key's value, or adds it at the front, then
+	//						evicts from the back while over capacity.  The
+	//						new entry is added before anything is evicted,
+	//						so a throwing copy leaves the cache unchanged.
+	//	Parameters:		const Key& key- the key to store.
+	//					const Value& value- its value.
+	//	Returns:		None
+	//	Calls:			IndexedList's find, move_to_front, push_front and
+	//						pop_back methods
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever copying key or value throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	void LRUCache<Key, Value, Hash, Alloc>::put(const Key& key,
+		const Value& value)
+	{
+		typename list_type::iterator it = m_list.find(key);
+		if (it != typename list_type::iterator())
+		{
+			it->second = value;
+			m_list.move_to_front(it);
+			return;
+		}
+		m_list.push_front(entry(key, value));
+		while (m_list.getSize() > m_capacity)
+			m_list.pop_back();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			ClockCache<Key, Value>::ClockCache(size_t capacity,
+	//						const Hash& hash, const Alloc& alloc)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor.  Sizes the index for capacity entries.
+	//	Parameters:		size_t capacity- the most entries to hold.
+	//					const Hash& hash- hashes the keys.
+	//					const Alloc& alloc- allocates the entries.
+	//	Returns:		None
+	//	Calls:			IndexedList's reserve method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range for a capacity of 0.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	ClockCache<Key, Value, Hash, Alloc>::ClockCache(size_t capacity,
+		const Hash& hash, const Alloc& alloc)
+		: m_ring(EntryKey(), hash, alloc), m_capacity(capacity), m_hits(0),
+		m_misses(0)
+	{
+		if (capacity == 0)
+			throw out_of_range("Could not create cache: Bad capacity");
+		m_ring.reserve(capacity);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			ClockCache& ClockCache<Key, Value>::operator=
+	//						(const ClockCache& x)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Copies x, putting the hand on the copy of x's hand
+	//						entry.
+	//	Parameters:		const ClockCache& x- the cache to copy.
+	//	Returns:		*this
+	//	Calls:			IndexedList's operator= and find methods
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	ClockCache<Key, Value, Hash, Alloc>&
+		ClockCache<Key, Value, Hash, Alloc>::operator=(const ClockCache& x)
+	{
+		if (this != &x)
+		{
+			m_ring = x.m_ring;
+			m_hand = x.empty() ? iterator() : m_ring.find(x.m_hand->key);
+			m_capacity = x.m_capacity;
+			m_hits = x.m_hits;
+			m_misses = x.m_misses;
+		}
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			ClockCache& ClockCache<Key, Value>::operator=
+	//						(ClockCache&& x)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Takes x's entries and hand, leaving x empty.  When
+	//						the allocators keep x's nodes from coming over,
+	//						the entries are moved into new nodes and the hand
+	//						is found again by its key.
+	//	Parameters:		ClockCache&& x- the cache to move from.
+	//	Returns:		*this
+	//	Calls:			IndexedList's operator= and find methods
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, the hand no
+	//						longer points into x's freed nodes.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	ClockCache<Key, Value, Hash, Alloc>&
+		ClockCache<Key, Value, Hash, Alloc>::operator=(ClockCache&& x)
+	{
+		typedef typename allocator_traits<Alloc>::template
+			rebind_traits<entry> traits;
+		if (this != &x)
+		{
+			if (x.empty() ||
+				traits::propagate_on_container_move_assignment::value ||
+				m_ring.get_allocator() == x.m_ring.get_allocator())
+			{
+				m_ring = std::move(x.m_ring);
+				m_hand = x.m_hand;
+			}
+			else
+			{
+				Key handKey = x.m_hand->key;
+				m_ring = std::move(x.m_ring);
+				m_hand = m_ring.find(handKey);
+			}
+			x.m_hand = iterator();
+			m_capacity = x.m_capacity;
+			m_hits = x.m_hits;
+			m_misses = x.m_misses;
+		}
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool ClockCache<Key, Value>::get(const Key& key,
+	//						Value& value)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Looks key up.  On a hit, copies its value out and
+	//						sets its referenced bit.
+	//	Parameters:		const Key& key- the key to look up.
+	//					Value& value- receives the value on a hit.
+	//	Returns:		True on a hit.
+	//	Calls:			IndexedList's find method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	bool ClockCache<Key, Value, Hash, Alloc>::get(const Key& key,
+		Value& value)
+	{
+		iterator it = m_ring.find(key);
+		if (it == iterator())
+		{
+			m_misses++;
+			return false;
+		}
+		value = it->value;
+		it->referenced = true;
+		m_hits++;
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void ClockCache<Key, Value>::put(const Key& key,
+	//						const Value& value)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Replaces key's value and sets its referenced bit, or
+	//						links a new unreferenced entry in just behind the
+	//						hand and, if that overfills the cache, evicts
+	//						some other entry.
+	//	Parameters:		const Key& key- the key to store.
+	//					const Value& value- its value.
+	//	Returns:		None
+	//	Calls:			evict()
+	//					IndexedList's find and insert methods
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever copying key or value, or allocating,
+	//						throws.  The cache is then unchanged.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, inserts
+	//						before evicting, so a throw loses no entry.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	void ClockCache<Key, Value, Hash, Alloc>::put(const Key& key,
+		const Value& value)
+	{
+		iterator it = m_ring.find(key);
+		if (it != iterator())
+		{
+			it->value = value;
+			it->referenced = true;
+			return;
+		}
+		it = m_ring.insert(m_hand, entry(key, value));
+		if (m_hand == iterator())
+			m_hand = it;
+		if (m_ring.getSize() > m_capacity)
+			evict(it);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool ClockCache<Key, Value>::erase(const Key& key)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Removes key, moving the hand on if it pointed there.
+	//	Parameters:		const Key& key- the key to remove.
+	//	Returns:		True if key was cached.
+	//	Calls:			IndexedList's find and erase methods
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	bool ClockCache<Key, Value, Hash, Alloc>::erase(const Key& key)
+	{
+		iterator it = m_ring.find(key);
+		if (it == iterator())
+			return false;
+		if (it == m_hand)
+			m_hand = m_ring.erase(it);
+		else
+			m_ring.erase(it);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void ClockCache<Key, Value>::evict(iterator keep)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Walks the hand along the ring, clearing referenced
+	//						bits, to the first entry other than keep whose
+	//						bit was already clear, and removes it.  The hand
+	//						is left on the entry after it.  At most one lap
+	//						is needed.
+	//	Parameters:		iterator keep- the entry just added, which must
+	//						not be the one evicted.
+	//	Returns:		None
+	//	Calls:			IndexedList's erase method
+	//	Called by:		put()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, skips keep,
+	//						as put() now inserts before evicting.
+	//------------------------------------------------------------------------
+	template<class Key, class Value, class Hash, class Alloc>
+	void ClockCache<Key, Value, Hash, Alloc>::evict(iterator keep)
+	{
+		while (m_hand->referenced || m_hand == keep)
+		{
+			m_hand->referenced = false;
+			++m_hand;
+		}
+		m_hand = m_ring.erase(m_hand);
+	}
+} // End DL_CDLL namespace.
+
+#endif
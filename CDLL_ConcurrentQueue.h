@@ -0,0 +1,398 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_ConcurrentQueue.h
+//
+//	Class:			ConcurrentQueue
+//
+//	Title:			Concurrent Queue with Separate Head and Tail Locks
+//
+//	Description:	This file contains the class definitions for the
+//						ConcurrentQueue Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class ConcurrentQueue:
+//		Description:
+//			A FIFO queue that any number of threads may push to and pop from
+//				at once.  It offers the push/pop/empty/getSize interface of
+//				Queue, but is a singly-linked chain that always starts with
+//				a dummy node: the front element lives in the node after the
+//				dummy, and popping it turns that node into the new dummy.
+//				Because the dummy keeps head and tail from ever sharing a
+//				node that both ends modify, producers only take the tail
+//				lock and consumers only take the head lock, so pushes and
+//				pops do not serialize against each other.  Nodes are
+//				allocated before the tail lock is taken and freed after the
+//				head lock is released, so only the pointer swap happens
+//				inside a lock.  Padding keeps the two ends on separate
+//				cache lines.
+//
+//			Alloc must be safe to call from several threads at once, as
+//				std::allocator is.  A PoolAllocator is not.
+//
+//		Properties:
+//			node* head-		The dummy node.  Guarded by m_headLock.
+//			node* tail-		The last node.  Guarded by m_tailLock.
+//			atomic<unsigned> m_size- The number of elements.  While a push
+//								is in flight it may already count the
+//								element being pushed.
+//			node_allocator m_alloc- The allocator, rebound from Alloc to
+//								node, that every node is allocated from.
+//
+//		Classes and structs contained within:
+//			node-			One link of the chain.
+//				Properties:
+//						atomic<node*> next- The next node, or nullptr.
+//						storage- Raw, aligned room for one DataType.  It is
+//							empty in the dummy node.
+//
+//		Methods:
+//			ConcurrentQueue()- Default constructor.
+//			explicit ConcurrentQueue(const Alloc& alloc)- Constructor
+//				taking the allocator.
+//			~ConcurrentQueue()- Destructor.  No other thread may be using
+//				the queue.
+//			void push(const DataType& datum), void push(DataType&& datum)-
+//				Adds an element at the back.
+//			void emplace(Args&&... args)- Constructs an element at the back.
+//			DataType pop()- Removes and returns the front element.  Throws
+//				runtime_error if the queue is empty.
+//			bool try_pop(DataType& out)- Moves the front element into out
+//				and returns true, or returns false if the queue is empty.
+//			bool empty() const- Tests whether the queue is empty.
+//			unsigned getSize() const- The number of elements.
+//			Alloc get_allocator() const- A copy of the allocator.
+//			node* new_node()- Allocates a node with no data. (private)
+//			void free_node(node* n)- Frees a node with no data. (private)
+//			node* head_next() const- The node after the dummy. (private)
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_CONCURRENT_QUEUE_H
+#define DL_CDLL_CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class DataType, class Alloc = allocator<DataType> >
+	class ConcurrentQueue
+	{
+	public:
+		ConcurrentQueue();
+		explicit ConcurrentQueue(const Alloc& alloc);
+		~ConcurrentQueue();
+
+		void push(const DataType& datum) { emplace(datum); }
+		void push(DataType&& datum) { emplace(std::move(datum)); }
+		template<class... Args>
+		void emplace(Args&&... args);
+		DataType pop();
+		bool try_pop(DataType& out);
+		bool empty() const
+			{ return head_next() == nullptr; }
+		unsigned getSize() const
+			{ return m_size.load(memory_order_relaxed); }
+		Alloc get_allocator() const { return Alloc(m_alloc); }
+	private:
+		struct node
+		{
+			atomic<node*> next;
+			alignas(DataType) unsigned char storage[sizeof(DataType)];
+			DataType* data() { return reinterpret_cast<DataType*>(storage); }
+		};
+		typedef typename allocator_traits<Alloc>::template
+			rebind_alloc<node> node_allocator;
+		typedef allocator_traits<node_allocator> node_traits;
+
+		ConcurrentQueue(const ConcurrentQueue&);
+		ConcurrentQueue& operator=(const ConcurrentQueue&);
+		node* new_node();
+		void free_node(node* n);
+		node* head_next() const;
+
+		// The consumer end and the producer end sit on separate cache lines
+		// so that pushing does not keep invalidating the line pop reads.
+		// A full line of padding between them does that wherever the queue
+		// lands, without over-aligning it as alignas(64) would.
+		static const size_t cache_line = 64;
+
+		// Properties:
+		char m_padBefore[cache_line];
+		mutable mutex m_headLock;
+		node* head;
+		char m_padHead[cache_line];
+		mutex m_tailLock;
+		node* tail;
+		char m_padTail[cache_line];
+		atomic<unsigned> m_size;
+		node_allocator m_alloc;
+	}; // End ConcurrentQueue class declarations.
+
+	// Definitions for the ConcurrentQueue class now follow.
+
+	//------------------------------------------------------------------------
+	//	Method:			ConcurrentQueue<DataType>::ConcurrentQueue()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Default constructor.  Creates the dummy node.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			new_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	ConcurrentQueue<DataType, Alloc>::ConcurrentQueue() : m_size(0)
+	{
+		head = tail = new_node();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			ConcurrentQueue<DataType>::ConcurrentQueue
+	//						(const Alloc& alloc)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor taking the allocator.  Creates the dummy
+	//						node.
+	//	Parameters:		const Alloc& alloc- the allocator for the nodes.
+	//	Returns:		None
+	//	Calls:			new_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	ConcurrentQueue<DataType, Alloc>::ConcurrentQueue(const Alloc& alloc)
+		: m_size(0), m_alloc(alloc)
+	{
+		head = tail = new_node();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			ConcurrentQueue<DataType>::~ConcurrentQueue()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destructor.  Destroys the remaining elements and
+	//						frees every node, the dummy included.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			free_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	ConcurrentQueue<DataType, Alloc>::~ConcurrentQueue()
+	{
+		node* n = head->next.load(memory_order_relaxed);
+		free_node(head);
+		while (n != nullptr)
+		{
+			node* next = n->next.load(memory_order_relaxed);
+			n->data()->~DataType();
+			free_node(n);
+			n = next;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void ConcurrentQueue<DataType>::emplace
+	//						(Args&&... args)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Adds an element at the back of the queue,
+	//						constructing it in place.  The node is built
+	//						before the tail lock is taken; the lock only
+	//						covers linking it in.
+	//	Parameters:		Args&&... args- the arguments for DataType's
+	//						constructor.
+	//	Returns:		None
+	//	Calls:			new_node()
+	//					free_node()
+	//	Called by:		push()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  The queue is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	template <class... Args>
+	void ConcurrentQueue<DataType, Alloc>::emplace(Args&&... args)
+	{
+		node* n = new_node();
+		try
+		{
+			::new (static_cast<void*>(n->data()))
+				DataType(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			free_node(n);
+			throw;
+		}
+		// Counted before it is published so a racing pop can never take
+		// m_size below zero.
+		m_size.fetch_add(1, memory_order_relaxed);
+		lock_guard<mutex> lock(m_tailLock);
+		// Publishes the element to the consumer that reads this link.
+		tail->next.store(n, memory_order_release);
+		tail = n;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType ConcurrentQueue<DataType>::pop()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Removes the front element and returns it.
+	//	Parameters:		None
+	//	Returns:		The element that was at the front.
+	//	Calls:			free_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	DataType ConcurrentQueue<DataType, Alloc>::pop()
+	{
+		unique_lock<mutex> lock(m_headLock);
+		node* first = head->next.load(memory_order_acquire);
+		if (first == nullptr)
+			throw runtime_error("Could not remove front item: Empty list");
+		DataType data = std::move(*first->data());
+		first->data()->~DataType();
+		node* old = head;
+		head = first; // first becomes the dummy
+		lock.unlock();
+		m_size.fetch_sub(1, memory_order_relaxed);
+		free_node(old);
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool ConcurrentQueue<DataType>::try_pop
+	//						(DataType& out)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves the front element into out, if there is one.
+	//						Unlike pop(), an empty queue is not an error.
+	//	Parameters:		DataType& out- where the front element is moved.
+	//	Returns:		true if an element was removed, false if the queue
+	//						was empty.
+	//	Calls:			free_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool ConcurrentQueue<DataType, Alloc>::try_pop(DataType& out)
+	{
+		node* old;
+		{
+			lock_guard<mutex> lock(m_headLock);
+			node* first = head->next.load(memory_order_acquire);
+			if (first == nullptr)
+				return false;
+			out = std::move(*first->data());
+			first->data()->~DataType();
+			old = head;
+			head = first;
+		}
+		m_size.fetch_sub(1, memory_order_relaxed);
+		free_node(old);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			node* ConcurrentQueue<DataType>::head_next() const
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Reads the link after the dummy node under the head
+	//						lock.
+	//	Parameters:		None
+	//	Returns:		The node holding the front element, or nullptr if
+	//						the queue is empty.
+	//	Calls:			None
+	//	Called by:		empty()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	typename ConcurrentQueue<DataType, Alloc>::node*
+		ConcurrentQueue<DataType, Alloc>::head_next() const
+	{
+		lock_guard<mutex> lock(m_headLock);
+		return head->next.load(memory_order_acquire);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			node* ConcurrentQueue<DataType>::new_node()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Allocates a node with no data and no next node.
+	//	Parameters:		None
+	//	Returns:		A pointer to the node.
+	//	Calls:			None
+	//	Called by:		The constructors
+	//					emplace()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	typename ConcurrentQueue<DataType, Alloc>::node*
+		ConcurrentQueue<DataType, Alloc>::new_node()
+	{
+		node* n = node_traits::allocate(m_alloc, 1);
+		::new (static_cast<void*>(&n->next)) atomic<node*>(nullptr);
+		return n;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void ConcurrentQueue<DataType>::free_node(node* n)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Frees a node whose data has already been destroyed.
+	//	Parameters:		node* n- the node to free.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		~ConcurrentQueue() (the destructor)
+	//					emplace(); pop(); try_pop()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	void ConcurrentQueue<DataType, Alloc>::free_node(node* n)
+	{
+		typedef atomic<node*> link;
+		n->next.~link();
+		node_traits::deallocate(m_alloc, n, 1);
+	}
+} // End DL_CDLL namespace.
+
+#endif
@@ -0,0 +1,449 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_IndexedList.h
+//
+//	Class:			IndexedList
+//					IdentityKey
+//
+//	Title:			Circular Doubly-Linked List with a Hash Index
+//
+//	Description:	This file contains the class definitions for the
+//						IndexedList Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class IndexedList:
+//		Description:
+//			A circular doubly-linked list that keeps a hash index from each
+//				element's key to its node, so finding, erasing or moving an
+//				element by key is O(1).  Every push, pop, insert and erase
+//				keeps the index in sync.  KeyOf extracts the key from an
+//				element, and defaults to the element itself; keys must be
+//				unique.  Built on List with StaticDispatch, so it has no
+//				vtable.
+//
+//			An element's key must not be changed in place (through front(),
+//				back(), an iterator, or find()) while it is in the list.
+//
+//		Properties:
+//			The List's head, tail, m_size and m_alloc, as for List.
+//			unordered_map<key_type, listelem*, Hash> m_index- The node of
+//							every key in the list.
+//			KeyOf m_keyOf-	Extracts the key from an element.
+//
+//		Methods:
+//			IndexedList()- Default constructor.
+//			explicit IndexedList(const KeyOf& keyOf, const Hash& hash,
+//				const Alloc& alloc)- Constructor taking the key extractor,
+//				hash and allocator.
+//			IndexedList(const IndexedList& x), IndexedList(IndexedList&& x)-
+//				Copy and move constructors.  The move constructor is
+//				noexcept when moving the index and copying KeyOf are.
+//			IndexedList& operator=(const IndexedList& x),
+//				IndexedList& operator=(IndexedList&& x)- Copy and move
+//				assignment.  This list takes x's KeyOf and hash as well as
+//				its elements.  A move keeps x's index when the
+//				allocators let x's nodes change hands, and rebuilds it
+//				when List had to move element by element.
+//			unsigned getSize() const, bool empty() const- As for List.
+//			iterator begin() const, iterator end() const- The head and the
+//				tail, as for List.
+//			const_range_iterator cbegin() const, cend() const,
+//				ListRange<const_range_iterator> range() const- Read-only
+//				traversal from the head to one past the tail.
+//			DataType& front() const, DataType& back() const- As for List.
+//			iterator push_front(const DataType& datum),
+//				iterator push_front(DataType&& datum),
+//				iterator push_back(const DataType& datum),
+//				iterator push_back(DataType&& datum)- Adds an element at the
+//				front or back and indexes it.  Throws runtime_error if its
+//				key is already in the list.
+//			iterator insert(iterator pos, const DataType& datum),
+//				iterator insert(iterator pos, DataType&& datum)- Adds an
+//				element ahead of pos, or at the back for iterator().
+//				Throws runtime_error if its key is already in the list.
+//			DataType pop_front(), DataType pop_back()- As for List, also
+//				dropping the key from the index.
+//			iterator erase(iterator pos)- Removes the element at pos and
+//				returns the node after it, as for List.
+//			bool erase(const key_type& key)- Removes the element with key,
+//				if there is one.  Returns whether there was.
+//			iterator find(const key_type& key) const- The element with key,
+//				or iterator() if there is none.
+//			bool contains(const key_type& key) const- Whether an element
+//				has key.
+//			void move_to_front(iterator pos), void move_to_back(iterator pos)-
+//				Relinks the element at pos at the front or back in O(1).
+//			void release()- Empties the list and the index.
+//			void reserve(size_t n)- Sizes the index for n keys.
+//			Alloc get_allocator() const- As for List.
+//			iterator add(iterator pos, Value&& datum)- Indexes datum's key,
+//				then links it in ahead of pos.  (private)
+//			void rebuild_index()- Indexes every node.  (private)
+//
+//	Struct IdentityKey:
+//		The default KeyOf: returns the element itself.
+//
+//	Functions:
+//		ostream& operator<<(ostream& sout, const IndexedList<DataType>& x)-
+//			Outputs the list to the indicated output stream.
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_INDEXED_LIST_H
+#define DL_CDLL_INDEXED_LIST_H
+
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include "CircDoubLinkList.h"
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	// The default KeyOf for IndexedList: each element is its own key.
+	template<class DataType>
+	struct IdentityKey
+	{
+		const DataType& operator()(const DataType& datum) const
+			{ return datum; }
+	};
+
+	// The key type KeyOf extracts from a DataType.
+	template<class DataType, class KeyOf>
+	struct IndexKey
+	{
+		typedef typename decay<decltype(declval<const KeyOf&>()
+			(declval<const DataType&>()))>::type type;
+	};
+
+	template<class DataType, class KeyOf = IdentityKey<DataType>,
+		class Hash = hash<typename IndexKey<DataType, KeyOf>::type>,
+		class Alloc = allocator<DataType> >
+	class IndexedList : protected List<DataType, Alloc, StaticDispatch>
+	{
+		typedef List<DataType, Alloc, StaticDispatch> list_type;
+	public:
+		typedef typename list_type::listelem listelem;
+		typedef typename list_type::iterator iterator;
+		typedef typename list_type::const_range_iterator
+			const_range_iterator;
+		typedef typename IndexKey<DataType, KeyOf>::type key_type;
+
+		IndexedList() {}
+		explicit IndexedList(const KeyOf& keyOf, const Hash& hash = Hash(),
+			const Alloc& alloc = Alloc())
+			: list_type(alloc), m_index(0, hash), m_keyOf(keyOf) {}
+		IndexedList(const IndexedList& x)
+			: list_type(x), m_index(0, x.m_index.hash_function()),
+			m_keyOf(x.m_keyOf)
+			{ rebuild_index(); }
+		IndexedList(IndexedList&& x)
+			noexcept(is_nothrow_move_constructible<index_type>::value &&
+				is_nothrow_copy_constructible<KeyOf>::value)
+			: list_type(std::move(x)), m_index(std::move(x.m_index)),
+			m_keyOf(x.m_keyOf)
+			{ x.m_index.clear(); }
+		IndexedList& operator=(const IndexedList& x)
+		{
+			if (this != &x)
+			{
+				list_type::operator=(x);
+				m_keyOf = x.m_keyOf;
+				m_index = index_type(0, x.m_index.hash_function());
+				rebuild_index();
+			}
+			return *this;
+		}
+		IndexedList& operator=(IndexedList&& x)
+		{
+			if (this != &x)
+			{
+				// The same test List's move assignment makes: unless the
+				// allocators let x's nodes change hands, it moves each
+				// element into a new node.
+				bool transfer = allocator_traits<Alloc>::
+					propagate_on_container_move_assignment::value ||
+					get_allocator() == x.get_allocator();
+				list_type::operator=(std::move(x));
+				m_keyOf = x.m_keyOf;
+				if (transfer)
+					m_index = std::move(x.m_index); // x's nodes came over
+				else
+				{ // the elements were moved into new nodes
+					m_index = index_type(0, x.m_index.hash_function());
+					rebuild_index();
+				}
+				x.m_index.clear();
+			}
+			return *this;
+		}
+
+		unsigned getSize() const { return list_type::getSize(); }
+		bool empty() const { return list_type::empty(); }
+		iterator begin() const { return list_type::begin(); }
+		iterator end() const { return list_type::end(); }
+		const_range_iterator cbegin() const { return list_type::cbegin(); }
+		const_range_iterator cend() const { return list_type::cend(); }
+		ListRange<const_range_iterator> range() const
+			{ return list_type::range(); }
+		DataType& front() const { return list_type::front(); }
+		DataType& back() const { return list_type::back(); }
+
+		iterator push_front(const DataType& datum)
+			{ return add(begin(), datum); }
+		iterator push_front(DataType&& datum)
+			{ return add(begin(), std::move(datum)); }
+		iterator push_back(const DataType& datum)
+			{ return add(iterator(), datum); }
+		iterator push_back(DataType&& datum)
+			{ return add(iterator(), std::move(datum)); }
+		iterator insert(iterator pos, const DataType& datum)
+			{ return add(pos, datum); }
+		iterator insert(iterator pos, DataType&& datum)
+			{ return add(pos, std::move(datum)); }
+		DataType pop_front()
+		{
+			if (!empty())
+				m_index.erase(m_keyOf(front()));
+			return list_type::pop_front();
+		}
+		DataType pop_back()
+		{
+			if (!empty())
+				m_index.erase(m_keyOf(back()));
+			return list_type::pop_back();
+		}
+		iterator erase(iterator pos)
+		{
+			if (static_cast<listelem*>(pos) != nullptr)
+				m_index.erase(m_keyOf(*pos));
+			return list_type::erase(pos);
+		}
+		bool erase(const key_type& key);
+		iterator find(const key_type& key) const
+		{
+			typename index_type::const_iterator found = m_index.find(key);
+			return found == m_index.end() ? iterator()
+				: iterator(found->second);
+		}
+		bool contains(const key_type& key) const
+			{ return m_index.find(key) != m_index.end(); }
+		void move_to_front(iterator pos);
+		void move_to_back(iterator pos);
+		void release()
+		{
+			m_index.clear();
+			list_type::release();
+		}
+		void reserve(size_t n) { m_index.reserve(n); }
+		Alloc get_allocator() const { return list_type::get_allocator(); }
+	private:
+		typedef unordered_map<key_type, listelem*, Hash> index_type;
+
+		template<class Value>
+		iterator add(iterator pos, Value&& datum);
+		void rebuild_index();
+
+		// Properties:
+		index_type m_index; // the node of every key
+		KeyOf m_keyOf; // extracts the key from an element
+	};
+
+	template <class DataType, class KeyOf, class Hash, class Alloc>
+	ostream& operator<<(ostream& sout,
+		const IndexedList<DataType, KeyOf, Hash, Alloc>& x);
+
+	//------------------------------------------------------------------------
+	//	Method:			bool IndexedList<DataType>::erase(const key_type& key)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Removes the element whose key is key, if there is
+	//						one, in O(1).
+	//	Parameters:		const key_type& key- the key to remove.
+	//	Returns:		True if an element was removed.
+	//	Calls:			List's erase method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class KeyOf, class Hash, class Alloc>
+	bool IndexedList<DataType, KeyOf, Hash, Alloc>::erase(const key_type& key)
+	{
+		typename index_type::iterator found = m_index.find(key);
+		if (found == m_index.end())
+			return false;
+		listelem* node = found->second;
+		m_index.erase(found);
+		list_type::erase(node);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void IndexedList<DataType>::move_to_front
+	//						(iterator pos)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Relinks the element at pos, which must be in this
+	//						list, at the front in O(1).  The index is
+	//						unchanged, since the node is the same.
+	//	Parameters:		iterator pos- the element to move.
+	//	Returns:		None
+	//	Calls:			List's splice method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class KeyOf, class Hash, class Alloc>
+	void IndexedList<DataType, KeyOf, Hash, Alloc>::move_to_front
+		(iterator pos)
+	{
+		if (static_cast<listelem*>(pos) == nullptr)
+			throw runtime_error("Could not move item: nullptr pointer");
+		if (pos != begin())
+			list_type::splice(begin(), *this, pos);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void IndexedList<DataType>::move_to_back
+	//						(iterator pos)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Relinks the element at pos, which must be in this
+	//						list, at the back in O(1).
+	//	Parameters:		iterator pos- the element to move.
+	//	Returns:		None
+	//	Calls:			List's splice method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class KeyOf, class Hash, class Alloc>
+	void IndexedList<DataType, KeyOf, Hash, Alloc>::move_to_back
+		(iterator pos)
+	{
+		if (static_cast<listelem*>(pos) == nullptr)
+			throw runtime_error("Could not move item: nullptr pointer");
+		if (pos != end())
+			list_type::splice(iterator(), *this, pos);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			iterator IndexedList<DataType>::add(iterator pos,
+	//						Value&& datum)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Claims datum's key in the index, then links a new
+	//						node holding datum in ahead of pos.  If the node
+	//						cannot be made, the key is given back.
+	//	Parameters:		iterator pos- the node to insert ahead of, or
+	//						iterator() for the back.
+	//					Value&& datum- the element to copy or move in.
+	//	Returns:		An iterator to the new node.
+	//	Calls:			List's emplace method
+	//	Called by:		push_front(); push_back(); insert()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error on a duplicate key, and whatever
+	//						copying datum or allocating throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class KeyOf, class Hash, class Alloc>
+	template <class Value>
+	typename IndexedList<DataType, KeyOf, Hash, Alloc>::iterator
+		IndexedList<DataType, KeyOf, Hash, Alloc>::add(iterator pos,
+		Value&& datum)
+	{
+		pair<typename index_type::iterator, bool> slot =
+			m_index.emplace(m_keyOf(datum), nullptr);
+		if (!slot.second)
+			throw runtime_error("Could not add item: duplicate key");
+		try
+		{
+			slot.first->second =
+				list_type::emplace(pos, std::forward<Value>(datum));
+		}
+		catch (...)
+		{
+			m_index.erase(slot.first);
+			throw;
+		}
+		return slot.first->second;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void IndexedList<DataType>::rebuild_index()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Clears the index and indexes every node again, after
+	//						the list has been copied, or moved element by
+	//						element.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		Copy constructor
+	//					operator=
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class KeyOf, class Hash, class Alloc>
+	void IndexedList<DataType, KeyOf, Hash, Alloc>::rebuild_index()
+	{
+		m_index.clear();
+		m_index.reserve(getSize());
+		iterator it = begin();
+		for (unsigned i = getSize(); i > 0; i--, ++it)
+			m_index.emplace(m_keyOf(*it), static_cast<listelem*>(it));
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		ostream& operator<<
+	//						(ostream& sout, const IndexedList<DataType>& x)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	prints out a list
+	//	Parameters:		ostream& sout- A reference to the output stream.
+	//					const IndexedList<DataType>& x- A reference to the
+	//						item to be printed.
+	//	Returns:		The ostream&
+	//	Calls:			cbegin()
+	//					cend()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			The data contents of the list.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class KeyOf, class Hash, class Alloc>
+	ostream& operator<<(ostream& sout,
+		const IndexedList<DataType, KeyOf, Hash, Alloc>& x)
+	{
+		typename IndexedList<DataType, KeyOf, Hash, Alloc>::
+			const_range_iterator p = x.cbegin(), e = x.cend();
+		sout << "(";
+		if (p != e)
+		{
+			sout << *p;
+			for (++p; p != e; ++p)
+				sout << "," << *p;
+		}
+		sout << ")\n";
+		return sout;
+	}
+} // End DL_CDLL namespace.
+
+#endif
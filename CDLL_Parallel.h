@@ -0,0 +1,384 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_Parallel.h
+//
+//	Functions:		parallel_for_each, parallel_transform, parallel_reduce,
+//					parallel_sort
+//
+//	Title:			Parallel Traversal of a Circular Doubly-Linked List
+//
+//	Description:	This file contains function templates that split a List
+//						(or Queue) into segments and work on the segments
+//						on several threads at once.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Description:
+//		Each function takes the list and an optional thread count (0, the
+//			default, means thread::hardware_concurrency()).  One walk over
+//			the list's range() finds the first node of every segment, the
+//			segments are as near equal in length as the count allows, and
+//			the calling thread works on the first one while a new thread
+//			works on each of the others.  The functions return once every
+//			segment is done.  If the work throws, the first exception (in
+//			segment order) is rethrown after all the threads have joined.
+//			If a thread cannot be started, its segment runs on the calling
+//			thread instead.
+//
+//		The list must not change shape while a function runs.  The work
+//			done on each element must not touch other elements.
+//
+//	Functions:
+//		void parallel_for_each(Container& x, UnaryFunction f,
+//			unsigned threads)- Calls f(element) on every element.
+//		void parallel_transform(Container& x, UnaryOperation op,
+//			unsigned threads)- Replaces every element with op(element).
+//		T parallel_reduce(const Container& x, T init, BinaryOperation op,
+//			unsigned threads)- Combines init and every element with op,
+//			which must be associative.  The elements are combined in list
+//			order, so op need not be commutative.
+//		void parallel_sort(List& x, Compare comp, unsigned threads)-
+//			Splits x into one list per thread, sorts them at once with
+//			List::sort(), and merges them back, pairwise, with
+//			List::merge().  The sort is stable.
+//		void parallel_segments(Iterator first, unsigned count,
+//			unsigned threads, SegmentFunction work)- Splits the count
+//			elements from first into segments and calls
+//			work(segment, begin, end) for each on its own thread.  Used by
+//			the three above.
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_PARALLEL_H
+#define DL_CDLL_PARALLEL_H
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <system_error>
+#include <type_traits>
+#include <thread>
+#include <vector>
+#include "CircDoubLinkList.h"
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	//------------------------------------------------------------------------
+	//	Function:		void parallel_segments(Iterator first,
+	//						unsigned count, unsigned threads,
+	//						SegmentFunction work)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Splits the count elements from first into one
+	//						segment per thread, and calls
+	//						work(segment, begin, end) for every segment, the
+	//						first on the calling thread and each of the rest
+	//						on a new thread.
+	//	Parameters:		Iterator first- the first element.
+	//					unsigned count- the number of elements.
+	//					unsigned threads- the most threads to use, or 0 for
+	//						thread::hardware_concurrency().
+	//					SegmentFunction work- called as work(unsigned
+	//						segment, Iterator begin, Iterator end).
+	//	Returns:		None
+	//	Calls:			work
+	//	Called by:		parallel_for_each(); parallel_transform();
+	//					parallel_reduce()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever work throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Iterator, class SegmentFunction>
+	void parallel_segments(Iterator first, unsigned count, unsigned threads,
+		SegmentFunction work)
+	{
+		if (threads == 0)
+			threads = thread::hardware_concurrency();
+		unsigned parts = threads < count ? threads : count;
+		if (parts == 0)
+			parts = count > 0 ? 1 : 0;
+		// One walk finds where every segment starts.
+		vector<Iterator> bounds;
+		bounds.reserve(parts + 1);
+		bounds.push_back(first);
+		for (unsigned i = 1; i <= parts; i++)
+		{
+			unsigned length = count / parts + (i <= count % parts ? 1 : 0);
+			for (unsigned j = 0; j < length; j++)
+				++first;
+			bounds.push_back(first);
+		}
+
+		vector<exception_ptr> errors(parts);
+		auto task = [&](unsigned segment)
+		{
+			try
+			{
+				work(segment, bounds[segment], bounds[segment + 1]);
+			}
+			catch (...)
+			{
+				errors[segment] = current_exception();
+			}
+		};
+		vector<thread> workers;
+		workers.reserve(parts);
+		unsigned started = 1;
+		try
+		{
+			for (; started < parts; started++)
+				workers.emplace_back(task, started);
+		}
+		catch (const system_error&)
+		{
+			// Out of threads: the rest run here.
+		}
+		for (unsigned segment = started; segment < parts; segment++)
+			task(segment);
+		if (parts > 0)
+			task(0);
+		for (thread& worker : workers)
+			worker.join();
+		for (exception_ptr& error : errors)
+			if (error)
+				rethrow_exception(error);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		void parallel_for_each(Container& x, UnaryFunction f,
+	//						unsigned threads)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Calls f on every element of x, splitting the work
+	//						across threads.
+	//	Parameters:		Container& x- a List or Queue.
+	//					UnaryFunction f- called as f(DataType&).
+	//					unsigned threads- the most threads to use, or 0 for
+	//						thread::hardware_concurrency().
+	//	Returns:		None
+	//	Calls:			parallel_segments(); range(); getSize()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever f throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Container, class UnaryFunction>
+	void parallel_for_each(Container& x, UnaryFunction f,
+		unsigned threads = 0)
+	{
+		typedef typename Container::range_iterator iterator;
+		parallel_segments(x.range().begin(), x.getSize(), threads,
+			[&f](unsigned, iterator first, iterator last)
+		{
+			for (; first != last; ++first)
+				f(*first);
+		});
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		void parallel_transform(Container& x,
+	//						UnaryOperation op, unsigned threads)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Replaces every element of x with op(element),
+	//						splitting the work across threads.
+	//	Parameters:		Container& x- a List or Queue.
+	//					UnaryOperation op- called as op(const DataType&),
+	//						returning the new value.
+	//					unsigned threads- the most threads to use, or 0 for
+	//						thread::hardware_concurrency().
+	//	Returns:		None
+	//	Calls:			parallel_segments(); range(); getSize()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever op throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Container, class UnaryOperation>
+	void parallel_transform(Container& x, UnaryOperation op,
+		unsigned threads = 0)
+	{
+		typedef typename Container::range_iterator iterator;
+		parallel_segments(x.range().begin(), x.getSize(), threads,
+			[&op](unsigned, iterator first, iterator last)
+		{
+			for (; first != last; ++first)
+				*first = op(*first);
+		});
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		T parallel_reduce(const Container& x, T init,
+	//						BinaryOperation op, unsigned threads)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Combines init and the elements of x with op.  Each
+	//						thread reduces its own segment, and the segment
+	//						results are then combined in list order.
+	//	Parameters:		const Container& x- a List or Queue.
+	//					T init- the starting value.
+	//					BinaryOperation op- an associative operation, called
+	//						as op(T, const DataType&) and op(T, T).
+	//					unsigned threads- the most threads to use, or 0 for
+	//						thread::hardware_concurrency().
+	//	Returns:		The combined value, or init if x is empty.
+	//	Calls:			parallel_segments(); cbegin(); getSize()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever op throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Container, class T, class BinaryOperation>
+	T parallel_reduce(const Container& x, T init, BinaryOperation op,
+		unsigned threads = 0)
+	{
+		typedef typename Container::const_range_iterator iterator;
+		if (threads == 0)
+			threads = thread::hardware_concurrency();
+		vector<T> partial(threads > 0 ? threads : 1, init);
+		parallel_segments(x.cbegin(), x.getSize(), threads,
+			[&](unsigned segment, iterator first, iterator last)
+		{
+			T sum = *first;
+			for (++first; first != last; ++first)
+				sum = op(sum, *first);
+			partial[segment] = sum;
+		});
+		unsigned segments = x.getSize() < partial.size() ?
+			x.getSize() : partial.size();
+		for (unsigned i = 0; i < segments; i++)
+			init = op(init, partial[i]);
+		return init;
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		void parallel_sort(List<DataType>& x, Compare comp,
+	//						unsigned threads)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Stable sort on several threads.  x is split with
+	//						split_at() into one list per thread, the lists
+	//						are sorted at once with List::sort(), and then
+	//						merged in pairs, each round of merges running at
+	//						once too, until one list is left.  No node is
+	//						allocated or copied.
+	//	Parameters:		List<DataType>& x- the list to sort.
+	//					Compare comp- a strict weak ordering.  A number
+	//						here is taken as the thread count instead.
+	//					unsigned threads- the most threads to use, or 0 for
+	//						thread::hardware_concurrency().
+	//	Returns:		None
+	//	Calls:			split_at(); sort(); merge(); concat();
+	//					parallel_segments()
+	//	Called by:		parallel_sort()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever comp throws.  x then keeps all of its
+	//						items, in an unspecified order.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc, class Dispatch, class Compare,
+		class = typename enable_if<!is_arithmetic<Compare>::value>::type>
+	void parallel_sort(List<DataType, Alloc, Dispatch>& x, Compare comp,
+		unsigned threads = 0)
+	{
+		typedef List<DataType, Alloc, Dispatch> list_type;
+		if (threads == 0)
+			threads = thread::hardware_concurrency();
+		unsigned parts = threads < x.getSize() / 2 ? threads
+			: x.getSize() / 2;
+		if (parts < 2)
+		{
+			x.sort(comp);
+			return;
+		}
+		// One walk finds where every part starts, then the parts are split
+		//	off from the back so each split_at() only walks its own part.
+		vector<typename list_type::iterator> bounds;
+		bounds.reserve(parts);
+		typename list_type::iterator it = x.begin();
+		for (unsigned i = 0; i < parts; i++)
+		{
+			bounds.push_back(it);
+			unsigned length = x.getSize() / parts
+				+ (i < x.getSize() % parts ? 1 : 0);
+			for (unsigned j = 0; j < length; j++)
+				++it;
+		}
+		vector<list_type> pieces;
+		pieces.reserve(parts);
+		for (unsigned i = parts - 1; i > 0; i--)
+			pieces.push_back(x.split_at(bounds[i]));
+		pieces.push_back(list_type(std::move(x)));
+		reverse(pieces.begin(), pieces.end());
+
+		typedef typename vector<list_type>::iterator piece_iterator;
+		try
+		{
+			parallel_segments(pieces.begin(), parts, threads,
+				[&comp](unsigned, piece_iterator first, piece_iterator last)
+			{
+				for (; first != last; ++first)
+					first->sort(comp);
+			});
+			for (unsigned width = 1; width < parts; width *= 2)
+			{
+				vector<unsigned> lefts;
+				for (unsigned i = 0; i + width < parts; i += 2 * width)
+					lefts.push_back(i);
+				parallel_segments(lefts.begin(), lefts.size(), threads,
+					[&](unsigned, vector<unsigned>::iterator first,
+						vector<unsigned>::iterator last)
+				{
+					for (; first != last; ++first)
+						pieces[*first].merge(pieces[*first + width], comp);
+				});
+			}
+		}
+		catch (...)
+		{
+			for (list_type& piece : pieces)
+				x.concat(piece);
+			throw;
+		}
+		x.concat(pieces[0]);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		void parallel_sort(List<DataType>& x,
+	//						unsigned threads)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Sorts x into ascending order on several threads.
+	//	Parameters:		List<DataType>& x- the list to sort.
+	//					unsigned threads- the most threads to use, or 0 for
+	//						thread::hardware_concurrency().
+	//	Returns:		None
+	//	Calls:			parallel_sort(x, comp, threads)
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever operator< throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc, class Dispatch>
+	void parallel_sort(List<DataType, Alloc, Dispatch>& x,
+		unsigned threads = 0)
+	{
+		parallel_sort(x, less<DataType>(), threads);
+	}
+} // End DL_CDLL namespace.
+
+#endif
@@ -0,0 +1,392 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_PoolAllocator.h
+//
+//	Class:			PoolAllocator
+//
+//	Title:			Node Pool Allocator
+//
+//	Description:	This file contains the class definitions for the
+//						PoolAllocator Template Class and the NodePool class
+//						that backs it.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.1
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class NodePool:
+//		Description:
+//			Hands out fixed-size blocks carved from large contiguous chunks.
+//				Freed blocks are threaded onto a free list and handed out
+//				again before a new chunk is requested, so a container that
+//				pushes and pops at a steady rate stops calling operator new
+//				once its working set has been reached.  Chunks are only
+//				returned to the system when the pool is destroyed.  A
+//				NodePool is not thread-safe.
+//
+//		Properties:
+//			freenode* m_free-		The head of the free list.
+//			chunk* m_chunks-		The most recently allocated chunk.  Each
+//										chunk links to the one before it.
+//			size_t m_blockSize-		The size of each block handed out.  It is
+//										fixed by the first allocation.
+//			size_t m_chunkBlocks-	The number of blocks carved from each
+//										chunk.
+//			size_t m_chunkCount-	The number of chunks allocated so far.
+//			size_t m_capacity-		The number of blocks carved so far.
+//			size_t m_inUse-			The number of blocks currently handed out.
+//
+//		Methods:
+//			NodePool(size_t chunkBlocks)- Constructor.
+//			~NodePool()- Destructor.  Frees every chunk.
+//			bool owns(size_t bytes)- Tests whether a request for a single
+//				object of the given size is served by the pool.
+//			void* allocate(size_t bytes)- Hands out one block.
+//			void deallocate(void* p)- Returns one block to the free list.
+//			void reserve(size_t bytes, size_t n)- Makes sure n blocks can be
+//				handed out without carving another chunk.
+//			void deallocate_chain(void* first, void* last, size_t n)-
+//				Returns n blocks, linked through their first word, to the
+//				free list in O(1).
+//			size_t chunkCount() const- The number of chunks allocated.
+//			size_t inUse() const- The number of blocks handed out.
+//
+//	Class PoolAllocator:
+//		Description:
+//			A std::allocator-compatible allocator that serves single-object
+//				requests from a shared NodePool.  Copies of an allocator,
+//				including rebound copies, share the same pool, so a List
+//				built with a PoolAllocator carves its listelem nodes from the
+//				pool.  Requests for more than one object are passed on to
+//				operator new.  Two PoolAllocators compare equal when they
+//				share a pool.
+//
+//		Properties:
+//			shared_ptr<NodePool> m_pool- The pool shared by every copy.
+//
+//		Methods:
+//			PoolAllocator()- Default constructor.  Creates a new pool.
+//			PoolAllocator(const PoolAllocator<U, ChunkBlocks>& other)-
+//				Rebinding constructor.  Shares other's pool.
+//			PoolAllocator& operator=(const PoolAllocator& other)- Shares
+//				other's pool.
+//			T* allocate(size_t n)- Allocates storage for n objects.
+//			void deallocate(T* p, size_t n)- Frees storage for n objects.
+//			void reserve(size_t n)- Carves room for n single-object
+//				allocations up front.  List calls it, when the allocator has
+//				it, before copying a list.
+//			void deallocate_chain(T* first, T* last, size_t n)- Frees n
+//				objects that are chained through a next pointer stored as
+//				their first member, ending with last.  List::release()
+//				uses it to give a whole list back at once.
+//			NodePool& pool() const- Accesses the shared pool.
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_POOL_ALLOCATOR_H
+#define DL_CDLL_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace DL_CDLL
+{
+	class NodePool
+	{
+	public:
+		explicit NodePool(size_t chunkBlocks)
+			: m_free(nullptr), m_chunks(nullptr), m_blockSize(0),
+			m_chunkBlocks(chunkBlocks > 0 ? chunkBlocks : 1),
+			m_chunkCount(0), m_capacity(0), m_inUse(0) {}
+		~NodePool();
+		bool owns(size_t bytes) const
+			{ return m_blockSize == 0 || bytes <= m_blockSize; }
+		void* allocate(size_t bytes);
+		void deallocate(void* p);
+		void reserve(size_t bytes, size_t n);
+		void deallocate_chain(void* first, void* last, size_t n);
+		size_t chunkCount() const { return m_chunkCount; }
+		size_t inUse() const { return m_inUse; }
+	private:
+		NodePool(const NodePool&);
+		NodePool& operator=(const NodePool&);
+		void set_block_size(size_t bytes);
+		void grow(size_t blocks);
+
+		struct freenode { freenode* next; };
+		struct chunk { chunk* prev; };
+
+		freenode* m_free;
+		chunk* m_chunks;
+		size_t m_blockSize;
+		size_t m_chunkBlocks;
+		size_t m_chunkCount;
+		size_t m_capacity;
+		size_t m_inUse;
+	};
+
+	template<class T, size_t ChunkBlocks = 256>
+	class PoolAllocator
+	{
+	public:
+		typedef T value_type;
+		typedef std::true_type propagate_on_container_move_assignment;
+		typedef std::true_type propagate_on_container_swap;
+		template<class U> struct rebind
+			{ typedef PoolAllocator<U, ChunkBlocks> other; };
+
+		PoolAllocator() : m_pool(std::make_shared<NodePool>(ChunkBlocks)) {}
+		// Moving an allocator copies it so the source keeps its pool.
+		PoolAllocator(const PoolAllocator& other) : m_pool(other.m_pool) {}
+		PoolAllocator& operator=(const PoolAllocator&) = default;
+		template<class U>
+		PoolAllocator(const PoolAllocator<U, ChunkBlocks>& other)
+			: m_pool(other.m_pool) {}
+
+		T* allocate(size_t n)
+		{
+			if (n == 1 && m_pool->owns(sizeof(T)))
+				return static_cast<T*>(m_pool->allocate(sizeof(T)));
+			return static_cast<T*>(::operator new(n * sizeof(T)));
+		}
+		void deallocate(T* p, size_t n)
+		{
+			if (n == 1 && m_pool->owns(sizeof(T)))
+				m_pool->deallocate(p);
+			else
+				::operator delete(p);
+		}
+		void reserve(size_t n)
+		{
+			if (m_pool->owns(sizeof(T)))
+				m_pool->reserve(sizeof(T), n);
+		}
+		void deallocate_chain(T* first, T* last, size_t n)
+		{
+			if (m_pool->owns(sizeof(T)))
+				m_pool->deallocate_chain(first, last, n);
+			else
+			{ // each object came from operator new
+				while (first != nullptr)
+				{
+					T* next = *reinterpret_cast<T**>(first);
+					::operator delete(first);
+					first = next;
+				}
+			}
+		}
+		NodePool& pool() const { return *m_pool; }
+
+		template<class U>
+		bool operator==(const PoolAllocator<U, ChunkBlocks>& rhs) const
+			{ return m_pool == rhs.m_pool; }
+		template<class U>
+		bool operator!=(const PoolAllocator<U, ChunkBlocks>& rhs) const
+			{ return m_pool != rhs.m_pool; }
+	private:
+		template<class U, size_t N> friend class PoolAllocator;
+
+		std::shared_ptr<NodePool> m_pool;
+	};
+
+	// Definitions for the NodePool class now follow.
+
+	//------------------------------------------------------------------------
+	//	Method:			NodePool::~NodePool()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destructor.  Returns every chunk to the system.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline NodePool::~NodePool()
+	{
+		while (m_chunks != nullptr)
+		{
+			chunk* prev = m_chunks->prev;
+			::operator delete(m_chunks);
+			m_chunks = prev;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void* NodePool::allocate(size_t bytes)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Hands out one block from the free list, carving a new
+	//						chunk first if the free list is empty.  The first
+	//						call fixes the block size of the pool.
+	//	Parameters:		size_t bytes- the size of the object to store.
+	//	Returns:		A pointer to the block.
+	//	Calls:			set_block_size()
+	//					grow()
+	//	Called by:		PoolAllocator::allocate()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, moving the
+	//										block sizing to set_block_size().
+	//------------------------------------------------------------------------
+	inline void* NodePool::allocate(size_t bytes)
+	{
+		if (m_blockSize == 0)
+			set_block_size(bytes);
+		if (m_free == nullptr)
+			grow(m_chunkBlocks);
+		freenode* block = m_free;
+		m_free = block->next;
+		m_inUse++;
+		return block;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void NodePool::deallocate(void* p)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Returns one block to the front of the free list.
+	//	Parameters:		void* p- the block to return.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		PoolAllocator::deallocate()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline void NodePool::deallocate(void* p)
+	{
+		freenode* block = static_cast<freenode*>(p);
+		block->next = m_free;
+		m_free = block;
+		m_inUse--;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void NodePool::deallocate_chain(void* first,
+	//						void* last, size_t n)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Returns n blocks to the free list at once.  The
+	//						blocks must already be linked through their first
+	//						word, as the free list is, from first through
+	//						last; only last is touched.
+	//	Parameters:		void* first- the first block of the chain.
+	//					void* last- the last block of the chain.
+	//					size_t n- the number of blocks in the chain.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		PoolAllocator::deallocate_chain()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline void NodePool::deallocate_chain(void* first, void* last, size_t n)
+	{
+		static_cast<freenode*>(last)->next = m_free;
+		m_free = static_cast<freenode*>(first);
+		m_inUse -= n;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void NodePool::reserve(size_t bytes, size_t n)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Makes sure at least n blocks are on the free list,
+	//						carving the whole shortfall as one chunk so a
+	//						burst of n allocations is contiguous and does
+	//						not grow the pool chunk by chunk.
+	//	Parameters:		size_t bytes- the size of the objects to store.
+	//					size_t n- the number of blocks needed.
+	//	Returns:		None
+	//	Calls:			set_block_size()
+	//					grow()
+	//	Called by:		PoolAllocator::reserve()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline void NodePool::reserve(size_t bytes, size_t n)
+	{
+		if (m_blockSize == 0)
+			set_block_size(bytes);
+		size_t available = m_capacity - m_inUse;
+		if (n > available)
+			grow(n - available);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void NodePool::set_block_size(size_t bytes)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Fixes the block size of the pool from the size of
+	//						the first object requested.
+	//	Parameters:		size_t bytes- the size of the object to store.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		allocate()
+	//					reserve()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline void NodePool::set_block_size(size_t bytes)
+	{
+		// Round the block up so every block in a chunk stays aligned.
+		const size_t align = alignof(std::max_align_t);
+		size_t size = bytes < sizeof(freenode) ? sizeof(freenode) : bytes;
+		m_blockSize = (size + align - 1) / align * align;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void NodePool::grow(size_t blocks)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Allocates one new chunk and threads all of its blocks
+	//						onto the free list.
+	//	Parameters:		size_t blocks- the number of blocks in the chunk.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		allocate()
+	//					reserve()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, taking the
+	//										chunk size so reserve() can carve
+	//										a whole burst at once.
+	//------------------------------------------------------------------------
+	inline void NodePool::grow(size_t blocks)
+	{
+		// The chunk header takes up the first block so the rest stay aligned.
+		const size_t header = m_blockSize;
+		char* raw = static_cast<char*>
+			(::operator new(header + m_blockSize * blocks));
+		chunk* c = reinterpret_cast<chunk*>(raw);
+		c->prev = m_chunks;
+		m_chunks = c;
+		m_chunkCount++;
+		m_capacity += blocks;
+		char* first = raw + header;
+		for (size_t i = blocks; i > 0; --i)
+		{
+			freenode* block =
+				reinterpret_cast<freenode*>(first + (i - 1) * m_blockSize);
+			block->next = m_free;
+			m_free = block;
+		}
+	}
+} // End DL_CDLL namespace.
+
+#endif
@@ -0,0 +1,471 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_PriorityQueue.h
+//
+//	Class:			PriorityQueue
+//					BucketQueue
+//
+//	Title:			Priority Queues with the Queue Interface
+//
+//	Description:	This file contains the class definitions for the
+//						PriorityQueue and BucketQueue Template Classes.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class PriorityQueue:
+//		Description:
+//			A priority queue with Queue's push/pop/getSize/empty interface.
+//				pop() returns the element that orders first under Compare,
+//				so with the default less<DataType> it is the smallest.  The
+//				elements are kept in a d-ary heap in one vector: each node
+//				has Arity children, stored side by side, so a heap of
+//				Arity 4 is half as deep as a binary heap and each sift-down
+//				step reads one or two cache lines of children.  push() and
+//				pop() are O(log n); elements of equal priority come out in
+//				no particular order.
+//
+//		Properties:
+//			vector<DataType, Alloc> m_heap- The heap.  The children of
+//							m_heap[i] are m_heap[Arity * i + 1] through
+//							m_heap[Arity * i + Arity].
+//			Compare m_comp-	comp(a, b) is true when a must come out
+//							before b.
+//
+//		Methods:
+//			PriorityQueue()- Default constructor.
+//			explicit PriorityQueue(const Compare& comp, const Alloc& alloc)-
+//				Constructor taking the ordering and allocator.
+//			void push(const DataType& element),
+//				void push(DataType&& element)- Adds an element.
+//			void emplace(Args&&... args)- Adds an element constructed from
+//				args.
+//			DataType pop()- Removes and returns the first element.  Throws
+//				runtime_error if the queue is empty.
+//			const DataType& front() const- The first element.  Throws
+//				runtime_error if the queue is empty.
+//			unsigned getSize() const, bool empty() const- The number of
+//				elements, and whether there are none.
+//			void release()- Empties the queue.
+//			void reserve(size_t n)- Makes room for n elements.
+//			void sift_up(size_t i), void sift_down(size_t i)- Restore the
+//				heap order after the element at i changed.  (private)
+//
+//	Class BucketQueue:
+//		Description:
+//			A priority queue for small integer priorities, 0 (first out)
+//				to levels - 1.  Each priority has its own circular List,
+//				and a bitmap marks the lists that are not empty.  push()
+//				is a push_back() onto its level's list, and pop() finds the
+//				lowest marked level, 64 levels per word, and pops the front
+//				of its list, so both are O(1) for a fixed number of
+//				levels.  Elements of equal priority come out in the order
+//				they went in.
+//
+//		Properties:
+//			vector<level_list> m_levels- One List per priority.
+//			vector<unsigned long long> m_marks- Bit p % 64 of word p / 64
+//							is set while level p is not empty.
+//			unsigned m_size- The number of elements.
+//
+//		Methods:
+//			explicit BucketQueue(unsigned levels, const Alloc& alloc)-
+//				Constructor.  Throws out_of_range for 0 levels.
+//			void push(const DataType& element, unsigned priority),
+//				void push(DataType&& element, unsigned priority)- Adds an
+//				element at priority.  Throws out_of_range for a priority
+//				of levels or more.
+//			DataType pop()- Removes and returns the oldest element of the
+//				lowest priority.  Throws runtime_error if the queue is
+//				empty.
+//			const DataType& front() const- The element pop() would return.
+//			unsigned frontPriority() const- That element's priority.
+//			unsigned getSize() const, bool empty() const- The number of
+//				elements, and whether there are none.
+//			unsigned levels() const- The number of priorities.
+//			void release()- Empties the queue.
+//			unsigned lowest() const- The lowest level that is not empty.
+//				(private)
+//			static unsigned lowest_bit(unsigned long long word)- The index
+//				of word's lowest set bit.  (private)
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_PRIORITY_QUEUE_H
+#define DL_CDLL_PRIORITY_QUEUE_H
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "CircDoubLinkList.h"
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class DataType, class Compare = less<DataType>,
+		unsigned Arity = 4, class Alloc = allocator<DataType> >
+	class PriorityQueue
+	{
+		static_assert(Arity >= 2, "PriorityQueue needs an Arity of 2 or more");
+	public:
+		PriorityQueue() {}
+		explicit PriorityQueue(const Compare& comp,
+			const Alloc& alloc = Alloc())
+			: m_heap(alloc), m_comp(comp) {}
+
+		void push(const DataType& element)
+		{
+			m_heap.push_back(element);
+			sift_up(m_heap.size() - 1);
+		}
+		void push(DataType&& element)
+		{
+			m_heap.push_back(std::move(element));
+			sift_up(m_heap.size() - 1);
+		}
+		template<class... Args>
+		void emplace(Args&&... args)
+		{
+			m_heap.emplace_back(std::forward<Args>(args)...);
+			sift_up(m_heap.size() - 1);
+		}
+		DataType pop();
+		const DataType& front() const
+		{
+			if (m_heap.empty())
+				throw runtime_error("Could not read front item: Empty list");
+			return m_heap.front();
+		}
+		unsigned getSize() const
+			{ return static_cast<unsigned>(m_heap.size()); }
+		bool empty() const { return m_heap.empty(); }
+		void release() { m_heap.clear(); }
+		void reserve(size_t n) { m_heap.reserve(n); }
+	private:
+		void sift_up(size_t i);
+		void sift_down(size_t i);
+
+		// Properties:
+		vector<DataType, Alloc> m_heap;
+		Compare m_comp; // true when its first argument comes out first
+	};
+
+	template<class DataType, class Alloc = allocator<DataType> >
+	class BucketQueue
+	{
+		typedef List<DataType, Alloc, StaticDispatch> level_list;
+	public:
+		explicit BucketQueue(unsigned levels, const Alloc& alloc = Alloc());
+
+		void push(const DataType& element, unsigned priority)
+		{
+			check(priority);
+			m_levels[priority].push_back(element);
+			mark(priority);
+		}
+		void push(DataType&& element, unsigned priority)
+		{
+			check(priority);
+			m_levels[priority].push_back(std::move(element));
+			mark(priority);
+		}
+		DataType pop();
+		const DataType& front() const
+			{ return m_levels[frontPriority()].front(); }
+		unsigned frontPriority() const;
+		unsigned getSize() const { return m_size; }
+		bool empty() const { return m_size == 0; }
+		unsigned levels() const
+			{ return static_cast<unsigned>(m_levels.size()); }
+		void release();
+	private:
+		void check(unsigned priority) const
+		{
+			if (priority >= m_levels.size())
+				throw out_of_range("Could not add item: Bad priority");
+		}
+		void mark(unsigned priority)
+		{
+			m_marks[priority / 64] |= 1ULL << (priority % 64);
+			m_size++;
+		}
+		unsigned lowest() const;
+		static unsigned lowest_bit(unsigned long long word);
+
+		// Properties:
+		vector<level_list> m_levels; // one list per priority
+		vector<unsigned long long> m_marks; // the levels that are not empty
+		unsigned m_size;
+	};
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType PriorityQueue<DataType>::pop()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves the root out, moves the last element into its
+	//						place and sifts it down.
+	//	Parameters:		None
+	//	Returns:		The element that orders first.
+	//	Calls:			sift_down()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Compare, unsigned Arity, class Alloc>
+	DataType PriorityQueue<DataType, Compare, Arity, Alloc>::pop()
+	{
+		if (m_heap.empty())
+			throw runtime_error("Could not remove front item: Empty list");
+		DataType first = std::move(m_heap.front());
+		if (m_heap.size() > 1)
+		{
+			m_heap.front() = std::move(m_heap.back());
+			m_heap.pop_back();
+			sift_down(0);
+		}
+		else
+			m_heap.pop_back();
+		return first;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void PriorityQueue<DataType>::sift_up(size_t i)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves the element at i up past every parent it must
+	//						come out before.  The element is held aside and
+	//						the parents are moved down into the hole, so
+	//						each level costs one move, not a swap.
+	//	Parameters:		size_t i- the index of the new element.
+	//	Returns:		None
+	//	Calls:			m_comp
+	//	Called by:		push(); emplace()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Compare, unsigned Arity, class Alloc>
+	void PriorityQueue<DataType, Compare, Arity, Alloc>::sift_up(size_t i)
+	{
+		DataType element = std::move(m_heap[i]);
+		while (i > 0)
+		{
+			size_t parent = (i - 1) / Arity;
+			if (!m_comp(element, m_heap[parent]))
+				break;
+			m_heap[i] = std::move(m_heap[parent]);
+			i = parent;
+		}
+		m_heap[i] = std::move(element);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void PriorityQueue<DataType>::sift_down(size_t i)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves the element at i down, each step trading
+	//						places with the first of its Arity children,
+	//						until no child must come out before it.  Like
+	//						sift_up(), it moves into a hole.
+	//	Parameters:		size_t i- the index of the element to move.
+	//	Returns:		None
+	//	Calls:			m_comp
+	//	Called by:		pop()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Compare, unsigned Arity, class Alloc>
+	void PriorityQueue<DataType, Compare, Arity, Alloc>::sift_down(size_t i)
+	{
+		size_t size = m_heap.size();
+		DataType element = std::move(m_heap[i]);
+		for (;;)
+		{
+			size_t child = Arity * i + 1;
+			if (child >= size)
+				break;
+			size_t last = child + Arity < size ? child + Arity : size;
+			size_t best = child;
+			for (++child; child < last; child++)
+				if (m_comp(m_heap[child], m_heap[best]))
+					best = child;
+			if (!m_comp(m_heap[best], element))
+				break;
+			m_heap[i] = std::move(m_heap[best]);
+			i = best;
+		}
+		m_heap[i] = std::move(element);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			BucketQueue<DataType>::BucketQueue(unsigned levels,
+	//						const Alloc& alloc)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor.  Makes an empty list per level and a
+	//						cleared bitmap.
+	//	Parameters:		unsigned levels- the number of priorities.
+	//					const Alloc& alloc- the lists' allocator.
+	//	Returns:		None
+	//	Calls:			List allocator constructor
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range for 0 levels.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc>
+	BucketQueue<DataType, Alloc>::BucketQueue(unsigned levels,
+		const Alloc& alloc)
+		: m_marks((levels + 63) / 64, 0), m_size(0)
+	{
+		if (levels == 0)
+			throw out_of_range("Could not create queue: Bad levels");
+		m_levels.reserve(levels);
+		for (unsigned i = 0; i < levels; i++)
+			m_levels.emplace_back(alloc);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType BucketQueue<DataType>::pop()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Pops the front of the lowest non-empty level, and
+	//						clears its mark if that empties it.
+	//	Parameters:		None
+	//	Returns:		The oldest element of the lowest priority.
+	//	Calls:			lowest()
+	//					List's pop_front method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc>
+	DataType BucketQueue<DataType, Alloc>::pop()
+	{
+		if (m_size == 0)
+			throw runtime_error("Could not remove front item: Empty list");
+		unsigned priority = lowest();
+		level_list& level = m_levels[priority];
+		DataType element = level.pop_front();
+		if (level.empty())
+			m_marks[priority / 64] &= ~(1ULL << (priority % 64));
+		m_size--;
+		return element;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			unsigned BucketQueue<DataType>::frontPriority()
+	//						const
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Returns the priority of the element pop() would
+	//						return.
+	//	Parameters:		None
+	//	Returns:		The lowest non-empty level.
+	//	Calls:			lowest()
+	//	Called by:		front()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc>
+	unsigned BucketQueue<DataType, Alloc>::frontPriority() const
+	{
+		if (m_size == 0)
+			throw runtime_error("Could not read front item: Empty list");
+		return lowest();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void BucketQueue<DataType>::release()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Empties every marked level and clears the bitmap.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			List's release method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc>
+	void BucketQueue<DataType, Alloc>::release()
+	{
+		for (size_t word = 0; word < m_marks.size(); word++)
+			for (; m_marks[word] != 0; m_marks[word] &= m_marks[word] - 1)
+				m_levels[word * 64 + lowest_bit(m_marks[word])].release();
+		m_size = 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			unsigned BucketQueue<DataType>::lowest() const
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Finds the lowest marked level: the first non-zero
+	//						bitmap word, then its lowest set bit.  The queue
+	//						must not be empty.
+	//	Parameters:		None
+	//	Returns:		The level.
+	//	Calls:			lowest_bit()
+	//	Called by:		pop(); frontPriority()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc>
+	unsigned BucketQueue<DataType, Alloc>::lowest() const
+	{
+		size_t word = 0;
+		while (m_marks[word] == 0)
+			word++;
+		return static_cast<unsigned>(word * 64 + lowest_bit(m_marks[word]));
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			unsigned BucketQueue<DataType>::lowest_bit
+	//						(unsigned long long word)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Returns the index of the lowest set bit of a
+	//						non-zero word, isolating it and looking the
+	//						product with a de Bruijn sequence up in a table.
+	//						Portable, and branch-free.
+	//	Parameters:		unsigned long long word- the bits; not 0.
+	//	Returns:		0 to 63.
+	//	Calls:			None
+	//	Called by:		lowest(); release()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class DataType, class Alloc>
+	unsigned BucketQueue<DataType, Alloc>::lowest_bit(unsigned long long word)
+	{
+		static const unsigned char index[64] =
+		{
+			0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+			62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+			63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+			46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6
+		};
+		const unsigned long long debruijn = 0x03f79d71b4cb0a89ULL;
+		return index[((word & (0 - word)) * debruijn) >> 58];
+	}
+} // End DL_CDLL namespace.
+
+#endif
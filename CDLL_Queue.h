@@ -1,312 +1,493 @@
-//----------------------------------------------------------------------------
-//	File:			CDLL_Queue.h
-//
-//	Class:			Queue Class
-//
-//	Title:			Queue, Inherited from a Circular Doubly-Linked List
-//
-//	Description:	This file contains the class definitions for the
-//						Queue Template Class.
-//
-//	Programmer:		David Landry
-//
-//	Date:			5/14/2016
-//
-//	Version:		0.9
-//
-//	Environment:	Hardware:	PC with Intel Core i7
-//					Software:	Windows 10 64-bit edition
-//								Compiled using Microsoft Visual Studio 2013
-//									Community
-//
-//	Class Queue:
-//		Description:
-//			A queue, built around a circular doubly-linked list.  Data gets
-//				pushed in to the back and popped out from the front	(FIFO).
-//
-//		Properties:
-//			listelem head-	This is the node at the front of the queue.
-//							It is a listelem struct consisting of the
-//							data and pointers to the next and previous data
-//							node.  Its previous node is tail.
-//			listelem tail-	This is the node at the back of the queue.  
-//							It is a listelem struct consisting of the
-//							data and pointers to the next and previous data
-//							node.  Its next node is head.
-//			unsigned m_size-The number of data nodes in the queue.
-//
-//		Classes and structs contained within:
-//			listelem-		Each is one data node, containing a DataType, a
-//							pointer to previous, and a pointer to next.
-//				Properties:
-//						DataType data- The data contained within a node in the
-//							list.
-//						listelem *next- A pointer to the next linked node in
-//							the list (or the 1st if the current node is the
-//							tail).
-//						listelem *prev- A pointer to the previous linked node
-//							in the list (or to the last if the current node is
-//							the first).
-//				Method:		
-//						listelem(DataType datum, listelem* p, listelem* n)-
-//							The constructor for the listelem struct.
-//			iterator-		The iterator class.  This is a wrapper around a
-//							pointer associated with this list class.
-//				Properties:
-//						listelem* ptr- A pointer to the listelem that the
-//							iterator points to.
-//				Methods:
-//						iterator(listelem* p = nullptr)- Default constructor
-//						iterator operator++()- Prefix incrementer.
-//						iterator operator--()- Prefix decrementer.
-//						iterator operator++(int)- Postfix incrementer.
-//						iterator operator--(int)- Prefix decrementer.
-//						listelem* operator->() const- Target operator.
-//							Accesses listelem's members using the iterator.
-//						DataType& operator*() const- Dereferencing operator.
-//							Accesses the reference of the DataType.
-//						operator listelem*() const- Dereferencing operator.
-//							Accesses the value of the listelem.
-//
-//		Methods:
-//			Inline:
-//				Queue<DataType>()
-//					Description:	The default constructor
-//					Parameters:		None
-//					Returns:		None
-//					Calls:			List default constructor
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				Queue<DataType>(size_t n_elements, DataType datum)
-//					Description:	Constructor that fills the queue with a
-//										quantity of n_elements DataTypes.
-//					Parameters:		size_t n_elements- The quantity of items
-//										to fill the queue with.
-//									DataType datum- The default item to fill
-//										the queue with.
-//					Returns:		None
-//					Calls:			List fill constructor
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				Queue<DataType>(iterator b, iterator e)
-//					Description:	Constructor that copies elements from
-//										the indicated beginning and end
-//										points.
-//					Parameters:		iterator b- the beginning point.
-//									iterator e- the end point.
-//					Returns:		None
-//					Calls:			List iterator constructor
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				Queue<DataType>(const Queue& x)
-//					Description:	The copy constructor
-//					Parameters:		const Queue& x
-//					Returns:		None
-//					Calls:			List copy constructor
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				~List<DataType>()
-//					Description:	The destructor.
-//					Parameters:		None
-//					Returns:		None
-//					Calls:			release()
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				virtual unsigned getSize() const
-//					Description:	Returns the number of data nodes in the
-//										List.
-//					Parameters:		None
-//					Returns:		m_size
-//					Calls:			List's getSize method
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				virtual iterator begin() const
-//					Description:	Returns an iterator that points to the
-//										List's head.
-//					Parameters:		None
-//					Returns:		head
-//					Calls:			List's begin method
-//					Called by:		operator<<
-//					Input:			None
-//					Output:			None
-//				virtual iterator end() const
-//					Description:	Returns an iterator that points to the
-//										List's tail.
-//					Parameters:		None
-//					Returns:		tail
-//					Calls:			List's end method
-//					Called by:		operator<<
-//					Input:			None
-//					Output:			None
-//				virtual bool empty()const
-//					Description:	Tests whether the List is empty.
-//					Parameters:		None
-//					Returns:		True if either head or tail points to a
-//										nullptr.  Otherwise false.
-//					Calls:			List's empty method.
-//					Called by:		push_front(); push_back();
-//									pop_front(); pop_back()
-//					Input:			None
-//					Output:			None
-//				void release()
-//					Description:	empties the list
-//					Parameters:		None
-//					Returns:		None
-//					Calls:			List's release method
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				void push(DataType element)
-//					Description:	insert element at end of list
-//					Parameters:		DataType datum- the item to insert
-//					Returns:		None
-//					Calls:			List's push_back method
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				DataType pop()
-//					Description:	removes front element and returns the data 
-//										from that element
-//					Parameters:		None
-//					Returns:		A DataType equal to the item being popped.
-//					Calls:			List's pop_front method
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				virtual ~Queue<DataType>()
-//					Description:	The default constructor
-//					Parameters:		None
-//					Returns:		None
-//					Calls:			None
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//
-//	Functions:
-//		ostream& operator<<(ostream& sout, const List<DataType>& x)- Outputs 
-//			the list to the indicated output stream.
-//----------------------------------------------------------------------------
-#ifndef DL_CDLL_QUEUE_H
-#define DL_CDLL_QUEUE_H
-
-#include "CircDoubLinkList.h"
-
-namespace DL_CDLL
-{
-	template<class DataType>
-	class Queue: virtual protected List<DataType>
-	{
-		// Declarations will be here; definitions will be down below (except
-		//	for very simple one-line inline functions).
-	public:
-		Queue<DataType>():List<DataType>(){}
-		Queue<DataType>(size_t n_elements, DataType datum) :
-			List<DataType>(n_elements, datum){}
-		Queue<DataType>(iterator b, iterator e):
-			List<DataType>(b, e){}
-		Queue<DataType>(const List& x) :
-			List<DataType>(x){}	
-		virtual ~Queue<DataType>() { release(); }
-		unsigned getSize() const { return List<DataType>::getSize(); }
-		iterator begin() const { return List<DataType>::begin(); }
-		iterator end() const { return List<DataType>::end(); }
-		bool empty() const { return List<DataType>::empty(); }
-		void release() { List<DataType>::release(); }
-		void push(DataType element){ List<DataType>::push_back(element); }
-		DataType pop(){ return List<DataType>::pop_front(); }
-		class iterator
-		{
-		public:
-			iterator(listelem* p = nullptr) : ptr(p){}
-			// Prefix increment
-			iterator operator++()
-			{
-				if (ptr == nullptr)
-					throw runtime_error("nullptr pointer");
-				ptr = ptr->next;
-				return *this;
-			}
-			// Prefix decrement
-			iterator operator--()
-			{
-				if (ptr == nullptr)
-					throw runtime_error("nullptr pointer");
-				ptr = ptr->prev;
-				return *this;
-			}
-			// Postfix increment
-			iterator operator++(int)
-			{
-				if (ptr == nullptr)
-					throw runtime_error("nullptr pointer");
-				iterator temp = *this;
-				ptr = ptr->next;
-				return temp;
-			}
-			// Postfix decrement
-			iterator operator--(int)
-			{
-				if (ptr == nullptr)
-					throw runtime_error("nullptr pointer");
-				iterator temp = nullptr;
-				ptr = ptr->prev;
-				return temp;
-			}
-			listelem* operator->() const { return ptr; }
-			DataType& operator*() const { return ptr->data; }
-			operator listelem*() const { return ptr; }
-		private:
-			listelem* ptr; //current listelem or nullptr
-		};
-	};
-	template <class DataType>
-	ostream& operator<<(ostream& sout, const Queue<DataType>& x);
-
-	//------------------------------------------------------------------------
-	//	Function:		ostream& operator<<
-	//						(ostream& sout, const Queue<DataType>& x)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	prints out a list
-	//	Parameters:		ostream& sout- A reference to the output stream.
-	//					const Queue<DataType>& x- A reference to the item to 
-	//						be printed.
-	//	Returns:		The ostream&
-	//	Calls:			begin()
-	//					end()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			The data contents of the List.
-	//	Changelog		4/15/2011	PB	completed version 0.8
-	//					4/29/2016	DL	completed version 0.9, adapting it to
-	//										the template class List<DataType>.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	ostream& operator<<(ostream& sout, const Queue<DataType>& x)
-	{
-		Queue<DataType>::iterator p = x.begin(); // gets x.h
-		Queue<DataType>::iterator q = x.begin();	// gets x.h too.
-		sout << "(";
-		if (p != nullptr)
-		{
-			do
-			{
-				sout << *q;
-				if (q != x.end())
-					sout << ",";
-				++q; // advances iterator using next
-			} while (p != q);
-		}
-		sout << ")\n";
-		return sout;
-	}
-} // End DL_CDLL namespace.
-
+//----------------------------------------------------------------------------
+//	File:			CDLL_Queue.h
+//
+//	Class:			Queue Class
+//
+//	Title:			Queue, Inherited from a Circular Doubly-Linked List
+//
+//	Description:	This file contains the class definitions for the
+//						Queue Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.1
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class Queue:
+//		Description:
+//			A queue, built around a circular doubly-linked list.  Data gets
+//				pushed in to the back and popped out from the front	(FIFO).
+//
+//		Properties:
+//			listelem head-	This is the node at the front of the queue.
+//							It is a listelem struct consisting of the
+//							data and pointers to the next and previous data
+//							node.  Its previous node is tail.
+//			listelem tail-	This is the node at the back of the queue.  
+//							It is a listelem struct consisting of the
+//							data and pointers to the next and previous data
+//							node.  Its next node is head.
+//			unsigned m_size-The number of data nodes in the queue.
+//			node_allocator m_alloc-	The allocator every node is allocated
+//							from.  Alloc is passed on to the List; a
+//							PoolAllocator (CDLL_PoolAllocator.h) lets a
+//							queue that pushes and pops at a steady rate
+//							reuse its nodes.
+//			Dispatch-		DynamicDispatch (the default) or StaticDispatch,
+//							passed on to the List.  A
+//							Queue<DataType, Alloc, StaticDispatch> has no
+//							vtable pointer, so push(), pop() and getSize()
+//							can be inlined.
+//
+//		Classes and structs contained within:
+//			listelem-		Each is one data node, containing a DataType, a
+//							pointer to previous, and a pointer to next.
+//				Properties:
+//						DataType data- The data contained within a node in the
+//							list.
+//						listelem *next- A pointer to the next linked node in
+//							the list (or the 1st if the current node is the
+//							tail).
+//						listelem *prev- A pointer to the previous linked node
+//							in the list (or to the last if the current node is
+//							the first).
+//				Method:		
+//						listelem(DataType datum, listelem* p, listelem* n)-
+//							The constructor for the listelem struct.
+//			iterator-		The iterator class.  This is a wrapper around a
+//							pointer associated with this list class.
+//				Properties:
+//						listelem* ptr- A pointer to the listelem that the
+//							iterator points to.
+//				Methods:
+//						iterator(listelem* p = nullptr)- Default constructor
+//						iterator operator++()- Prefix incrementer.
+//						iterator operator--()- Prefix decrementer.
+//						iterator operator++(int)- Postfix incrementer.
+//						iterator operator--(int)- Prefix decrementer.
+//						listelem* operator->() const- Target operator.
+//							Accesses listelem's members using the iterator.
+//						DataType& operator*() const- Dereferencing operator.
+//							Accesses the reference of the DataType.
+//						operator listelem*() const- Dereferencing operator.
+//							Accesses the value of the listelem.
+//
+//		Methods:
+//			Inline:
+//				Queue<DataType>()
+//					Description:	The default constructor
+//					Parameters:		None
+//					Returns:		None
+//					Calls:			List default constructor
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Queue<DataType>(const Alloc& alloc)
+//					Description:	Constructor taking in the allocator to
+//										allocate nodes with.
+//					Parameters:		const Alloc& alloc- The allocator.
+//					Returns:		None
+//					Calls:			List allocator constructor
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Queue<DataType>(size_t n_elements, DataType datum,
+//					const Alloc& alloc)
+//					Description:	Constructor that fills the queue with a
+//										quantity of n_elements DataTypes.
+//					Parameters:		size_t n_elements- The quantity of items
+//										to fill the queue with.
+//									DataType datum- The default item to fill
+//										the queue with.
+//									const Alloc& alloc- The allocator.
+//					Returns:		None
+//					Calls:			List fill constructor
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Queue<DataType>(iterator b, iterator e, const Alloc& alloc)
+//					Description:	Constructor that copies elements from
+//										the indicated beginning and end
+//										points.
+//					Parameters:		iterator b- the beginning point.
+//									iterator e- the end point.
+//									const Alloc& alloc- The allocator.
+//					Returns:		None
+//					Calls:			List iterator constructor
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Queue<DataType>(const Queue& x)
+//					Description:	The copy constructor
+//					Parameters:		const Queue& x
+//					Returns:		None
+//					Calls:			List copy constructor
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Queue<DataType>(Queue&& x)
+//					Description:	The move constructor.  Takes over x's
+//										nodes, leaving x empty.  noexcept,
+//										like List's.
+//					Parameters:		Queue&& x
+//					Returns:		None
+//					Calls:			List move constructor
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				~List<DataType>()
+//					Description:	The destructor.
+//					Parameters:		None
+//					Returns:		None
+//					Calls:			release()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				unsigned getSize() const
+//					Description:	Returns the number of data nodes in the
+//										List.
+//					Parameters:		None
+//					Returns:		m_size
+//					Calls:			List's getSize method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				iterator begin() const
+//					Description:	Returns an iterator that points to the
+//										List's head.
+//					Parameters:		None
+//					Returns:		head
+//					Calls:			List's begin method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				iterator end() const
+//					Description:	Returns an iterator that points to the
+//										List's tail.
+//					Parameters:		None
+//					Returns:		tail
+//					Calls:			List's end method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				const_range_iterator cbegin() const
+//				const_range_iterator cend() const
+//					Description:	Return iterators to the front of the
+//										queue and one past its back.
+//					Parameters:		None
+//					Returns:		The const_range_iterators.
+//					Calls:			List's cbegin and cend methods
+//					Called by:		operator<<
+//					Input:			None
+//					Output:			None
+//				ListRange<range_iterator> range()
+//				ListRange<const_range_iterator> range() const
+//					Description:	Returns the whole queue, front to back,
+//										as a begin/end pair for range-for
+//										and <algorithm>.
+//					Parameters:		None
+//					Returns:		The pair of iterators.
+//					Calls:			List's range method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				bool empty()const
+//					Description:	Tests whether the List is empty.
+//					Parameters:		None
+//					Returns:		True if either head or tail points to a
+//										nullptr.  Otherwise false.
+//					Calls:			List's empty method.
+//					Called by:		push_front(); push_back();
+//									pop_front(); pop_back()
+//					Input:			None
+//					Output:			None
+//				void release()
+//					Description:	empties the list
+//					Parameters:		None
+//					Returns:		None
+//					Calls:			List's release method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				void push(const DataType& element)
+//				void push(DataType&& element)
+//					Description:	insert element at end of list, copying or
+//										moving it in
+//					Parameters:		DataType element- the item to insert
+//					Returns:		None
+//					Calls:			List's push_back method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				DataType& emplace(Args&&... args)
+//					Description:	insert an element at end of list,
+//										constructing it in place
+//					Parameters:		Args&&... args- the arguments for
+//										DataType's constructor
+//					Returns:		A reference to the new element.
+//					Calls:			List's emplace_back method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				DataType pop()
+//					Description:	removes front element and returns the data 
+//										from that element, moved out
+//					Parameters:		None
+//					Returns:		A DataType equal to the item being popped.
+//					Calls:			List's pop_front method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				bool try_pop(DataType& out)
+//					Description:	moves the front element into out and
+//										removes it, or returns false for an
+//										empty queue instead of throwing
+//					Parameters:		DataType& out- where the element is moved
+//					Returns:		true if an element was removed
+//					Calls:			List's try_pop_front method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Alloc get_allocator() const
+//					Description:	Returns a copy of the queue's allocator.
+//					Parameters:		None
+//					Returns:		The allocator.
+//					Calls:			List's get_allocator method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				void concat(Queue& x)
+//					Description:	moves all of x's elements onto the back of
+//										the queue in O(1), leaving x empty
+//					Parameters:		Queue& x- the queue to append
+//					Returns:		None
+//					Calls:			List's concat method
+//					Called by:		drain_into()
+//					Input:			None
+//					Output:			None
+//				void push_range(InputIt first, InputIt last)
+//					Description:	insert copies of the items from first up
+//										to last at end of list, linked in as
+//										one chain
+//					Parameters:		InputIt first- the first item to insert
+//									InputIt last- one past the last item
+//					Returns:		None
+//					Calls:			List's push_range method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				void push_n(size_t n, const DataType& element)
+//					Description:	insert n copies of element at end of
+//										list, linked in as one chain
+//					Parameters:		size_t n- the number of copies
+//									DataType element- the item to insert
+//					Returns:		None
+//					Calls:			List's push_n method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				OutputIt pop_n(OutputIt out, size_t n)
+//					Description:	removes up to n front elements as one
+//										chain and moves them out through out;
+//										an empty queue is not an error
+//					Parameters:		OutputIt out- where the items are written
+//									size_t n- the most items to remove
+//					Returns:		out, advanced past the last item written
+//					Calls:			List's pop_n method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				void drain_into(Queue& x)
+//				void drain_into(List& x)
+//					Description:	moves all of the queue's elements onto
+//										the back of x in O(1), leaving the
+//										queue empty
+//					Parameters:		x- the queue or list to append to
+//					Returns:		None
+//					Calls:			concat(); List's drain_into method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				void rotate(int k)
+//					Description:	moves the first k elements to the back
+//										(the last -k to the front, for a
+//										negative k) without allocating, so
+//										a round-robin queue can pop and
+//										requeue its front in O(1)
+//					Parameters:		int k- how far to rotate, default 1
+//					Returns:		None
+//					Calls:			List's rotate method
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Queue& operator=(const Queue& x)
+//				Queue& operator=(Queue&& x)
+//					Description:	Copy and move assignment.
+//					Parameters:		Queue x- the queue to copy or move from.
+//					Returns:		A reference to this queue.
+//					Calls:			List's operator=
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				~Queue<DataType>()
+//					Description:	The default constructor
+//					Parameters:		None
+//					Returns:		None
+//					Calls:			None
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//
+//	Functions:
+//		ostream& operator<<(ostream& sout, const List<DataType>& x)- Outputs 
+//			the list to the indicated output stream.
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_QUEUE_H
+#define DL_CDLL_QUEUE_H
+
+#include "CircDoubLinkList.h"
+
+namespace DL_CDLL
+{
+	template<class DataType, class Alloc = allocator<DataType>,
+		class Dispatch = DynamicDispatch>
+	class Queue: protected List<DataType, Alloc, Dispatch>
+	{
+		// Declarations will be here; definitions will be down below (except
+		//	for very simple one-line inline functions).
+	public:
+		// Queue shares List's node and iterator types so that begin() and
+		//	end() can override List's under DynamicDispatch.
+		typedef typename List<DataType, Alloc, Dispatch>::listelem listelem;
+		typedef typename List<DataType, Alloc, Dispatch>::iterator iterator;
+		typedef typename List<DataType, Alloc, Dispatch>::range_iterator
+			range_iterator;
+		typedef typename List<DataType, Alloc, Dispatch>::
+			const_range_iterator const_range_iterator;
+
+		Queue():List<DataType, Alloc, Dispatch>(){}
+		explicit Queue(const Alloc& alloc) :
+			List<DataType, Alloc, Dispatch>(alloc){}
+		Queue(size_t n_elements, DataType datum,
+			const Alloc& alloc = Alloc()) :
+			List<DataType, Alloc, Dispatch>(n_elements, datum, alloc){}
+		Queue(iterator b, iterator e, const Alloc& alloc = Alloc()):
+			List<DataType, Alloc, Dispatch>(b, e, alloc){}
+		Queue(const List<DataType, Alloc, Dispatch>& x) :
+			List<DataType, Alloc, Dispatch>(x){}	
+		Queue(const Queue& x) : List<DataType, Alloc, Dispatch>(x){}
+		Queue(Queue&& x) noexcept :
+			List<DataType, Alloc, Dispatch>(std::move(x)){}
+		~Queue() { release(); }
+		unsigned getSize() const
+			{ return List<DataType, Alloc, Dispatch>::getSize(); }
+		iterator begin() const
+			{ return List<DataType, Alloc, Dispatch>::begin(); }
+		iterator end() const
+			{ return List<DataType, Alloc, Dispatch>::end(); }
+		const_range_iterator cbegin() const
+			{ return List<DataType, Alloc, Dispatch>::cbegin(); }
+		const_range_iterator cend() const
+			{ return List<DataType, Alloc, Dispatch>::cend(); }
+		ListRange<range_iterator> range()
+			{ return List<DataType, Alloc, Dispatch>::range(); }
+		ListRange<const_range_iterator> range() const
+			{ return List<DataType, Alloc, Dispatch>::range(); }
+		bool empty() const
+			{ return List<DataType, Alloc, Dispatch>::empty(); }
+		void release() { List<DataType, Alloc, Dispatch>::release(); }
+		void push(const DataType& element)
+			{ List<DataType, Alloc, Dispatch>::push_back(element); }
+		void push(DataType&& element)
+			{ List<DataType, Alloc, Dispatch>::push_back
+				(std::move(element)); }
+		template<class... Args>
+		DataType& emplace(Args&&... args)
+		{
+			return List<DataType, Alloc, Dispatch>::emplace_back
+				(std::forward<Args>(args)...);
+		}
+		DataType pop()
+			{ return List<DataType, Alloc, Dispatch>::pop_front(); }
+		bool try_pop(DataType& out) noexcept(noexcept(
+			declval<List<DataType, Alloc, Dispatch>&>().try_pop_front(out)))
+			{ return List<DataType, Alloc, Dispatch>::try_pop_front(out); }
+		void concat(Queue& x)
+			{ List<DataType, Alloc, Dispatch>::concat(x); }
+		template<class InputIt>
+		void push_range(InputIt first, InputIt last)
+			{ List<DataType, Alloc, Dispatch>::push_range(first, last); }
+		void push_n(size_t n, const DataType& element)
+			{ List<DataType, Alloc, Dispatch>::push_n(n, element); }
+		template<class OutputIt>
+		OutputIt pop_n(OutputIt out, size_t n)
+			{ return List<DataType, Alloc, Dispatch>::pop_n(out, n); }
+		void drain_into(Queue& x) { x.concat(*this); }
+		void drain_into(List<DataType, Alloc, Dispatch>& x)
+			{ List<DataType, Alloc, Dispatch>::drain_into(x); }
+		void rotate(int k = 1)
+			{ List<DataType, Alloc, Dispatch>::rotate(k); }
+		Queue& operator=(const Queue& x)
+		{
+			List<DataType, Alloc, Dispatch>::operator=(x);
+			return *this;
+		}
+		Queue& operator=(Queue&& x)
+		{
+			List<DataType, Alloc, Dispatch>::operator=(std::move(x));
+			return *this;
+		}
+		Alloc get_allocator() const
+			{ return List<DataType, Alloc, Dispatch>::get_allocator(); }
+	};
+	template <class DataType, class Alloc, class Dispatch>
+	ostream& operator<<(ostream& sout,
+		const Queue<DataType, Alloc, Dispatch>& x);
+
+	//------------------------------------------------------------------------
+	//	Function:		ostream& operator<<
+	//						(ostream& sout, const Queue<DataType>& x)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	prints out a list
+	//	Parameters:		ostream& sout- A reference to the output stream.
+	//					const Queue<DataType>& x- A reference to the item to 
+	//						be printed.
+	//	Returns:		The ostream&
+	//	Calls:			cbegin()
+	//					cend()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			The data contents of the List.
+	//	Changelog		4/15/2011	PB	completed version 0.8
+	//					4/29/2016	DL	completed version 0.9, adapting it to
+	//										the template class List<DataType>.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, walking from
+	//										cbegin() to cend().
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	ostream& operator<<(ostream& sout,
+		const Queue<DataType, Alloc, Dispatch>& x)
+	{
+		typename Queue<DataType, Alloc, Dispatch>::const_range_iterator
+			p = x.cbegin(), e = x.cend();
+		sout << "(";
+		if (p != e)
+		{
+			sout << *p;
+			for (++p; p != e; ++p)
+				sout << "," << *p;
+		}
+		sout << ")\n";
+		return sout;
+	}
+} // End DL_CDLL namespace.
+
 #endif
\ No newline at end of file
@@ -0,0 +1,369 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_SPSCQueue.h
+//
+//	Class:			SPSCQueue
+//
+//	Title:			Bounded Single-Producer/Single-Consumer Ring Queue
+//
+//	Description:	This file contains the class definitions for the
+//						SPSCQueue Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class SPSCQueue:
+//		Description:
+//			A FIFO queue of fixed capacity for exactly one producer thread
+//				and one consumer thread.  It keeps Queue's push/pop naming
+//				so it can stand in for a Queue shared by two threads, but
+//				stores its elements in one contiguous ring allocated up
+//				front, so pushing and popping never allocate.  The capacity
+//				is rounded up to a power of two so a position in the ring is
+//				a mask rather than a division.
+//
+//			The producer only writes m_tail and the consumer only writes
+//				m_head; each publishes its index with a release store and
+//				reads the other's with an acquire load, so no lock is
+//				needed.  The two indices sit on separate cache lines, and
+//				each side keeps a private copy of the other side's index so
+//				it only rereads the shared one when the ring looks full (or
+//				empty).  The indices count up without wrapping; the slot is
+//				the index masked by capacity - 1.
+//
+//		Properties:
+//			DataType* m_ring-		The ring of capacity slots.
+//			size_t m_mask-			capacity - 1.
+//			atomic<size_t> m_head-	The number of elements popped so far.
+//										Written by the consumer.
+//			size_t m_tailCache-		The consumer's copy of m_tail.
+//			atomic<size_t> m_tail-	The number of elements pushed so far.
+//										Written by the producer.
+//			size_t m_headCache-		The producer's copy of m_head.
+//			Alloc m_alloc-			The allocator for the ring.
+//
+//		Methods:
+//			explicit SPSCQueue(size_t capacity, const Alloc& alloc)-
+//				Constructor.  Allocates a ring of at least capacity slots.
+//			~SPSCQueue()- Destructor.  No other thread may be using the
+//				queue.
+//			void push(const DataType& datum), void push(DataType&& datum)-
+//				Adds an element at the back.  Throws runtime_error if the
+//				queue is full.  Producer only.
+//			bool try_push(const DataType& datum),
+//				bool try_push(DataType&& datum)- Adds an element at the back
+//				and returns true, or returns false if the queue is full.
+//				Producer only.
+//			DataType pop()- Removes and returns the front element.  Throws
+//				runtime_error if the queue is empty.  Consumer only.
+//			bool try_pop(DataType& out)- Moves the front element into out
+//				and returns true, or returns false if the queue is empty.
+//				Consumer only.
+//			bool empty() const- Tests whether the queue is empty.
+//			unsigned getSize() const- The number of elements.
+//			size_t capacity() const- The number of slots in the ring.
+//			bool full()- Tests whether the producer has room. (private)
+//			bool ready()- Tests whether the consumer has an element.
+//				(private)
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_SPSC_QUEUE_H
+#define DL_CDLL_SPSC_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class DataType, class Alloc = allocator<DataType> >
+	class SPSCQueue
+	{
+	public:
+		explicit SPSCQueue(size_t capacity, const Alloc& alloc = Alloc());
+		~SPSCQueue();
+
+		void push(const DataType& datum)
+		{
+			if (!try_push(datum))
+				throw runtime_error("Could not add item: Full queue");
+		}
+		void push(DataType&& datum)
+		{
+			if (!try_push(std::move(datum)))
+				throw runtime_error("Could not add item: Full queue");
+		}
+		bool try_push(const DataType& datum);
+		bool try_push(DataType&& datum);
+		DataType pop();
+		bool try_pop(DataType& out);
+		bool empty() const
+			{ return m_head.load(memory_order_acquire) ==
+				m_tail.load(memory_order_acquire); }
+		unsigned getSize() const
+			{ return static_cast<unsigned>(m_tail.load(memory_order_acquire)
+				- m_head.load(memory_order_acquire)); }
+		size_t capacity() const { return m_mask + 1; }
+	private:
+		typedef allocator_traits<Alloc> alloc_traits;
+
+		SPSCQueue(const SPSCQueue&);
+		SPSCQueue& operator=(const SPSCQueue&);
+		bool full(size_t tail);
+		bool ready(size_t head);
+
+		// A full cache line of padding keeps each side's pair off the
+		// other's line, and off its neighbours', without over-aligning
+		// the queue as alignas(64) would.
+		static const size_t cache_line = 64;
+
+		// Properties:
+		DataType* m_ring;
+		size_t m_mask;
+		Alloc m_alloc;
+		char m_padRing[cache_line];
+		// Consumer side.
+		atomic<size_t> m_head;
+		size_t m_tailCache;
+		char m_padHead[cache_line];
+		// Producer side.
+		atomic<size_t> m_tail;
+		size_t m_headCache;
+		char m_padTail[cache_line];
+	}; // End SPSCQueue class declarations.
+
+	// Definitions for the SPSCQueue class now follow.
+
+	//------------------------------------------------------------------------
+	//	Method:			SPSCQueue<DataType>::SPSCQueue(size_t capacity,
+	//						const Alloc& alloc)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor.  Allocates the ring, rounding capacity
+	//						up to the next power of two.
+	//	Parameters:		size_t capacity- the least number of elements the
+	//						queue must hold.
+	//					const Alloc& alloc- the allocator for the ring.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range, bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	SPSCQueue<DataType, Alloc>::SPSCQueue(size_t capacity, const Alloc& alloc)
+		: m_alloc(alloc), m_head(0), m_tailCache(0), m_tail(0),
+		m_headCache(0)
+	{
+		if (capacity == 0 || capacity > (~size_t(0) >> 1) + 1)
+			throw out_of_range("Could not create queue: Bad capacity");
+		size_t slots = 1;
+		while (slots < capacity)
+			slots <<= 1;
+		m_mask = slots - 1;
+		m_ring = alloc_traits::allocate(m_alloc, slots);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			SPSCQueue<DataType>::~SPSCQueue()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destructor.  Destroys the remaining elements and
+	//						frees the ring.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	SPSCQueue<DataType, Alloc>::~SPSCQueue()
+	{
+		size_t tail = m_tail.load(memory_order_relaxed);
+		for (size_t i = m_head.load(memory_order_relaxed); i != tail; i++)
+			alloc_traits::destroy(m_alloc, m_ring + (i & m_mask));
+		alloc_traits::deallocate(m_alloc, m_ring, m_mask + 1);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool SPSCQueue<DataType>::try_push
+	//						(const DataType& datum)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Copies datum into the next free slot and publishes
+	//						it to the consumer, if there is room.  Producer
+	//						only.
+	//	Parameters:		const DataType& datum- the data to add.
+	//	Returns:		true if datum was added, false if the queue was full.
+	//	Calls:			full()
+	//	Called by:		push()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever DataType's copy constructor throws.  The
+	//						queue is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool SPSCQueue<DataType, Alloc>::try_push(const DataType& datum)
+	{
+		size_t tail = m_tail.load(memory_order_relaxed);
+		if (full(tail))
+			return false;
+		alloc_traits::construct(m_alloc, m_ring + (tail & m_mask), datum);
+		m_tail.store(tail + 1, memory_order_release);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool SPSCQueue<DataType>::try_push(DataType&& datum)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves datum into the next free slot and publishes
+	//						it to the consumer, if there is room.  Producer
+	//						only.
+	//	Parameters:		DataType&& datum- the data to add.  It is left
+	//						untouched if the queue is full.
+	//	Returns:		true if datum was added, false if the queue was full.
+	//	Calls:			full()
+	//	Called by:		push()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever DataType's move constructor throws.  The
+	//						queue is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool SPSCQueue<DataType, Alloc>::try_push(DataType&& datum)
+	{
+		size_t tail = m_tail.load(memory_order_relaxed);
+		if (full(tail))
+			return false;
+		alloc_traits::construct(m_alloc, m_ring + (tail & m_mask),
+			std::move(datum));
+		m_tail.store(tail + 1, memory_order_release);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType SPSCQueue<DataType>::pop()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Removes the front element and returns it.  Consumer
+	//						only.
+	//	Parameters:		None
+	//	Returns:		The element that was at the front.
+	//	Calls:			ready()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	DataType SPSCQueue<DataType, Alloc>::pop()
+	{
+		size_t head = m_head.load(memory_order_relaxed);
+		if (!ready(head))
+			throw runtime_error("Could not remove front item: Empty list");
+		DataType* item = m_ring + (head & m_mask);
+		DataType data = std::move(*item);
+		alloc_traits::destroy(m_alloc, item);
+		m_head.store(head + 1, memory_order_release);
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool SPSCQueue<DataType>::try_pop(DataType& out)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves the front element into out, if there is one,
+	//						and hands its slot back to the producer.
+	//						Consumer only.
+	//	Parameters:		DataType& out- where the front element is moved.
+	//	Returns:		true if an element was removed, false if the queue
+	//						was empty.
+	//	Calls:			ready()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool SPSCQueue<DataType, Alloc>::try_pop(DataType& out)
+	{
+		size_t head = m_head.load(memory_order_relaxed);
+		if (!ready(head))
+			return false;
+		DataType* item = m_ring + (head & m_mask);
+		out = std::move(*item);
+		alloc_traits::destroy(m_alloc, item);
+		m_head.store(head + 1, memory_order_release);
+		return true;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool SPSCQueue<DataType>::full(size_t tail)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Tests whether the ring is full, rereading the
+	//						consumer's index only when the cached copy says
+	//						it is.  Producer only.
+	//	Parameters:		size_t tail- the producer's current index.
+	//	Returns:		true if there is no free slot.
+	//	Calls:			None
+	//	Called by:		try_push()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool SPSCQueue<DataType, Alloc>::full(size_t tail)
+	{
+		if (tail - m_headCache <= m_mask)
+			return false;
+		// Acquire so the consumer is done with the slot before it is reused.
+		m_headCache = m_head.load(memory_order_acquire);
+		return tail - m_headCache > m_mask;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool SPSCQueue<DataType>::ready(size_t head)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Tests whether an element is waiting, rereading the
+	//						producer's index only when the cached copy says
+	//						the ring is empty.  Consumer only.
+	//	Parameters:		size_t head- the consumer's current index.
+	//	Returns:		true if there is an element to pop.
+	//	Calls:			None
+	//	Called by:		pop()
+	//					try_pop()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool SPSCQueue<DataType, Alloc>::ready(size_t head)
+	{
+		if (head != m_tailCache)
+			return true;
+		// Acquire so the element written before the index is visible.
+		m_tailCache = m_tail.load(memory_order_acquire);
+		return head != m_tailCache;
+	}
+} // End DL_CDLL namespace.
+
+#endif
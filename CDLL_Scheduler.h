@@ -0,0 +1,500 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_Scheduler.h
+//
+//	Class:			RoundRobinScheduler
+//
+//	Title:			Deficit Round-Robin Scheduler on the Circular List
+//
+//	Description:	This file contains the class definitions for the
+//						RoundRobinScheduler Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class RoundRobinScheduler:
+//		Description:
+//			A ring of runnable items, such as tasks or connections, handed
+//				out in weighted round-robin order by deficit round-robin
+//				(DRR).  Each item has a weight.  When the cursor reaches an
+//				item, the item's deficit grows by its weight, and the item
+//				is handed out until the costs charged for it use the deficit
+//				up; then the cursor moves on.  Costs default to 1, so an
+//				item of weight 3 gets three turns for every one that an item
+//				of weight 1 gets.  A cost above the deficit is carried as
+//				debt into later rounds.
+//
+//			An acquired item is busy: no one else is handed it until it is
+//				released.  Busy items are passed over and get no credit
+//				while they are busy.
+//
+//			Every method takes the scheduler's lock, so any number of
+//				threads may add, remove, acquire and release at once.
+//				run() starts worker threads that each take the next item,
+//				run it, and hand it back.  Items are added and removed in
+//				O(1), whether or not the cursor is on them.  An item is
+//				added just behind the cursor, so it gets its first turn at
+//				the end of the current round.
+//
+//		Properties:
+//			list_type m_ring-	The items, a List of entry.
+//			handle m_cursor-	The item whose turn it is, or handle() to
+//								start at the head.
+//			bool m_credited-	Whether the cursor's item has had its weight
+//								added for this turn.
+//			unsigned m_idle-	The number of items that are not busy.
+//			bool m_stopped-		Set by stop() to end run().
+//			mutex m_lock-		Guards everything above.
+//			condition_variable m_ready- Signalled when an item may have
+//								become free, or the ring empty.
+//
+//		Classes and structs contained within:
+//			entry-			One item on the ring.
+//				Properties:
+//						Item item- The item.
+//						long weight- Its quantum per turn.
+//						long deficit- The credit it has left.
+//						bool busy- Whether it has been acquired.
+//						bool removed- Whether remove() was called while it
+//							was busy.
+//
+//		Types exported:
+//			handle-			An iterator to an item's node.  It stays valid
+//							until the item is removed.
+//
+//		Methods:
+//			explicit RoundRobinScheduler(const Alloc& alloc)- Constructor.
+//			handle add(const Item& item, unsigned weight)- Adds an item.
+//				Throws out_of_range for a weight of 0.
+//			void remove(handle h)- Removes an item.  A busy item is removed
+//				when it is released.
+//			bool try_acquire(handle& h)- Hands out the next item by DRR.
+//				Returns false if every item is busy or there are none.
+//			void release(handle h, unsigned cost)- Hands an item back,
+//				charging cost (default 1) against its deficit.
+//			static Item& item(handle h)- The item at h.
+//			template<class Work> void run(unsigned threads, Work work)-
+//				Runs work(Item&) on threads worker threads (the calling
+//				thread is one of them; 0 means hardware_concurrency()).
+//				Each worker acquires the next item, calls work on it and
+//				releases it, or removes it if work returns false.  run()
+//				returns once the ring is empty or stop() is called.  If
+//				work throws, the workers stop and the first exception is
+//				rethrown; the item that threw is kept.
+//			void stop()- Makes run() return once the items being worked on
+//				are released.
+//			unsigned getSize() const, bool empty() const- The number of
+//				items, busy or not, and whether there are none.
+//			bool take(handle& h)- try_acquire() with the lock held.
+//				(private)
+//			void finish(handle h, unsigned cost, bool keep)- release(), or
+//				remove() if !keep, with the lock held.  (private)
+//			void drop(handle h)- Erases h, moving the cursor off it.
+//				(private)
+//			void skip_rounds()- Credits every idle item with the rounds
+//				they would all sit out in debt.  (private)
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_SCHEDULER_H
+#define DL_CDLL_SCHEDULER_H
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "CircDoubLinkList.h"
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class Item, class Alloc = allocator<Item> >
+	class RoundRobinScheduler
+	{
+		struct entry
+		{
+			Item item;
+			long weight; // quantum per turn
+			long deficit; // credit left
+			bool busy; // acquired and not yet released
+			bool removed; // remove() was called while busy
+			entry(const Item& i, unsigned w)
+				: item(i), weight(w), deficit(0), busy(false),
+				removed(false) {}
+		};
+		typedef List<entry,
+			typename allocator_traits<Alloc>::template rebind_alloc<entry>,
+			StaticDispatch> list_type;
+	public:
+		typedef typename list_type::iterator handle;
+
+		explicit RoundRobinScheduler(const Alloc& alloc = Alloc())
+			: m_ring(alloc), m_credited(false), m_idle(0), m_stopped(false)
+			{}
+
+		handle add(const Item& item, unsigned weight = 1);
+		void remove(handle h);
+		bool try_acquire(handle& h)
+		{
+			lock_guard<mutex> lock(m_lock);
+			return take(h);
+		}
+		void release(handle h, unsigned cost = 1)
+		{
+			lock_guard<mutex> lock(m_lock);
+			finish(h, cost, true);
+		}
+		static Item& item(handle h) { return h->item; }
+		template<class Work>
+		void run(unsigned threads, Work work);
+		void stop()
+		{
+			lock_guard<mutex> lock(m_lock);
+			m_stopped = true;
+			m_ready.notify_all();
+		}
+		unsigned getSize() const
+		{
+			lock_guard<mutex> lock(m_lock);
+			return m_ring.getSize();
+		}
+		bool empty() const
+		{
+			lock_guard<mutex> lock(m_lock);
+			return m_ring.empty();
+		}
+	private:
+		bool take(handle& h);
+		void finish(handle h, unsigned cost, bool keep);
+		void drop(handle h);
+		void skip_rounds();
+
+		// Properties:
+		list_type m_ring;
+		handle m_cursor; // whose turn it is
+		bool m_credited; // m_cursor has had its weight for this turn
+		unsigned m_idle; // items not busy
+		bool m_stopped;
+		mutable mutex m_lock;
+		condition_variable m_ready;
+	};
+
+	//------------------------------------------------------------------------
+	//	Method:			handle RoundRobinScheduler<Item>::add
+	//						(const Item& item, unsigned weight)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Links a copy of item in just behind the cursor, with
+	//						no credit, and wakes a waiting worker.
+	//	Parameters:		const Item& item- the item to add.
+	//					unsigned weight- its quantum per turn.
+	//	Returns:		The new item's handle.
+	//	Calls:			List's insert method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range for a weight of 0, and whatever copying
+	//						item or allocating throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Item, class Alloc>
+	typename RoundRobinScheduler<Item, Alloc>::handle
+		RoundRobinScheduler<Item, Alloc>::add(const Item& item,
+		unsigned weight)
+	{
+		if (weight == 0)
+			throw out_of_range("Could not add item: Bad weight");
+		lock_guard<mutex> lock(m_lock);
+		handle h = m_ring.insert(m_cursor, entry(item, weight));
+		m_idle++;
+		m_ready.notify_one();
+		return h;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void RoundRobinScheduler<Item>::remove(handle h)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Removes the item at h, or, if it is busy, marks it
+	//						to be removed when it is released.
+	//	Parameters:		handle h- the item to remove.
+	//	Returns:		None
+	//	Calls:			drop()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Item, class Alloc>
+	void RoundRobinScheduler<Item, Alloc>::remove(handle h)
+	{
+		if (h == handle())
+			throw runtime_error("Could not remove item: nullptr pointer");
+		lock_guard<mutex> lock(m_lock);
+		if (h->busy)
+		{
+			h->removed = true;
+			return;
+		}
+		m_idle--;
+		drop(h);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool RoundRobinScheduler<Item>::take(handle& h)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Walks the cursor forward to the first idle item that
+	//						has credit, adding each idle item's weight to its
+	//						deficit as the cursor reaches it, and marks that
+	//						item busy.  The cursor stays on it, so it keeps
+	//						its turn until its deficit is used up.  If a
+	//						whole lap finds no credit, skip_rounds() settles
+	//						the debt at once, so a call visits each item at
+	//						most about twice.
+	//	Parameters:		handle& h- receives the item.
+	//	Returns:		False if there is no idle item.
+	//	Calls:			skip_rounds()
+	//	Called by:		try_acquire(); run()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Item, class Alloc>
+	bool RoundRobinScheduler<Item, Alloc>::take(handle& h)
+	{
+		if (m_idle == 0)
+			return false;
+		if (m_cursor == handle())
+		{
+			m_cursor = m_ring.begin();
+			m_credited = false;
+		}
+		for (unsigned visited = 0; ; visited++)
+		{
+			if (visited == m_ring.getSize())
+			{
+				skip_rounds();
+				visited = 0;
+			}
+			entry& e = *m_cursor;
+			if (!e.busy)
+			{
+				if (!m_credited)
+				{
+					e.deficit += e.weight;
+					m_credited = true;
+				}
+				if (e.deficit > 0)
+				{
+					e.busy = true;
+					m_idle--;
+					h = m_cursor;
+					return true;
+				}
+			}
+			++m_cursor;
+			m_credited = false;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void RoundRobinScheduler<Item>::finish(handle h,
+	//						unsigned cost, bool keep)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Charges cost to a busy item and frees it, or removes
+	//						it if !keep or remove() was called on it.  Wakes
+	//						one waiting worker, or all of them once the ring
+	//						is empty.
+	//	Parameters:		handle h- the busy item.
+	//					unsigned cost- the cost of its turn.
+	//					bool keep- false to remove it.
+	//	Returns:		None
+	//	Calls:			drop()
+	//	Called by:		release(); run()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error if h is not busy.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Item, class Alloc>
+	void RoundRobinScheduler<Item, Alloc>::finish(handle h, unsigned cost,
+		bool keep)
+	{
+		if (h == handle() || !h->busy)
+			throw runtime_error("Could not release item: Not acquired");
+		h->busy = false;
+		h->deficit -= static_cast<long>(cost);
+		if (!keep || h->removed)
+			drop(h);
+		else
+			m_idle++;
+		if (m_ring.empty())
+			m_ready.notify_all();
+		else
+			m_ready.notify_one();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void RoundRobinScheduler<Item>::drop(handle h)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Erases the item at h.  If the cursor was on it, the
+	//						next item's turn starts.
+	//	Parameters:		handle h- the item to erase.
+	//	Returns:		None
+	//	Calls:			List's erase method
+	//	Called by:		remove(); finish()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Item, class Alloc>
+	void RoundRobinScheduler<Item, Alloc>::drop(handle h)
+	{
+		if (h == m_cursor)
+		{
+			m_cursor = m_ring.erase(h);
+			m_credited = false;
+		}
+		else
+			m_ring.erase(h);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void RoundRobinScheduler<Item>::skip_rounds()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Called after a lap in which every idle item was
+	//						credited and is still in debt.  Finds the fewest
+	//						further laps, r, after which some idle item would
+	//						have credit, and gives every idle item the weight
+	//						of r - 1 laps at once, so the next lap hands an
+	//						item out just as r laps would have.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		take()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Item, class Alloc>
+	void RoundRobinScheduler<Item, Alloc>::skip_rounds()
+	{
+		long rounds = -1;
+		for (entry& e : m_ring.range())
+			if (!e.busy)
+			{
+				long needed = (1 - e.deficit + e.weight - 1) / e.weight;
+				if (rounds < 0 || needed < rounds)
+					rounds = needed;
+			}
+		if (rounds > 1)
+			for (entry& e : m_ring.range())
+				if (!e.busy)
+					e.deficit += (rounds - 1) * e.weight;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void RoundRobinScheduler<Item>::run(unsigned threads,
+	//						Work work)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Starts threads - 1 worker threads and works on the
+	//						calling thread too.  Each worker takes the next
+	//						item, calls work on it without the lock held,
+	//						and releases it at a cost of 1, or removes it if
+	//						work returned false.  With nothing to take, a
+	//						worker waits for an item to be released or
+	//						added.  Returns once the ring is empty or stop()
+	//						has been called, and every worker has finished.
+	//						If a thread cannot be started, run() goes on
+	//						with the workers it has.
+	//	Parameters:		unsigned threads- the number of workers, or 0 for
+	//						thread::hardware_concurrency().
+	//					Work work- called as bool work(Item&).
+	//	Returns:		None
+	//	Calls:			take(); finish(); work
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			The first exception work throws.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Item, class Alloc>
+	template<class Work>
+	void RoundRobinScheduler<Item, Alloc>::run(unsigned threads, Work work)
+	{
+		if (threads == 0)
+			threads = thread::hardware_concurrency();
+		{
+			lock_guard<mutex> lock(m_lock);
+			m_stopped = false;
+		}
+		exception_ptr error;
+		auto worker = [&]()
+		{
+			unique_lock<mutex> lock(m_lock);
+			handle h;
+			while (!m_stopped)
+			{
+				if (take(h))
+				{
+					lock.unlock();
+					bool keep = true;
+					try
+					{
+						keep = work(h->item);
+					}
+					catch (...)
+					{
+						lock.lock();
+						if (!error)
+							error = current_exception();
+						m_stopped = true;
+						m_ready.notify_all();
+						finish(h, 1, true);
+						break;
+					}
+					lock.lock();
+					finish(h, 1, keep);
+				}
+				else if (m_ring.empty())
+					break;
+				else
+					m_ready.wait(lock);
+			}
+		};
+		vector<thread> workers;
+		if (threads > 1)
+			workers.reserve(threads - 1);
+		try
+		{
+			while (workers.size() + 1 < threads)
+				workers.emplace_back(worker);
+		}
+		catch (const system_error&)
+		{
+			// Out of threads: carry on with those started.
+		}
+		worker();
+		for (thread& t : workers)
+			t.join();
+		if (error)
+			rethrow_exception(error);
+	}
+} // End DL_CDLL namespace.
+
+#endif
@@ -0,0 +1,656 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_SentinelList.h
+//
+//	Class:			SentinelList
+//
+//	Title:			Circular Doubly-Linked List with a Sentinel Node
+//
+//	Description:	This file contains the class definitions for the
+//						SentinelList Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class SentinelList:
+//		Description:
+//			The same circular doubly-linked list as List, laid out around a
+//				header (sentinel) node that lives inside the SentinelList
+//				object.  The sentinel sits between the tail and the head, so
+//				head is m_sentinel.next and tail is m_sentinel.prev, and an
+//				empty list is a sentinel linked to itself.  Every insertion
+//				is the same four-pointer splice and every removal the same
+//				two-pointer unlink, whether or not the list is empty, so
+//				push_front and push_back have no branches at all and
+//				pop_front and pop_back only test for the empty list they
+//				must report.  The iterators step over the sentinel, so
+//				iterating past the tail still wraps around to the head as it
+//				does in List.
+//
+//		Properties:
+//			nodebase m_sentinel-	The header node.  m_sentinel.next is the
+//										head and m_sentinel.prev the tail.
+//			unsigned m_size-		The number of data nodes in the list.
+//			node_allocator m_alloc-	The allocator every node is allocated
+//										from.
+//
+//		Classes and structs contained within:
+//			nodebase-		The links shared by the sentinel and data nodes.
+//			listelem-		A nodebase plus a DataType.
+//			iterator-		The iterator class.  Holds the current node and
+//								the sentinel to step over.
+//
+//		Methods:
+//			The constructors, push_front(), push_back(), emplace_front(),
+//				emplace_back(), pop_front(), pop_back(), front(), back(),
+//				begin(), end(), getSize(), empty(), release(), operator=
+//				and get_allocator() behave as they do in List.
+//			void link_before(nodebase* pos, nodebase* node)- Splices node in
+//				ahead of pos.  (private)
+//			listelem* unlink(nodebase* node)- Splices node out.  (private)
+//
+//	Functions:
+//		ostream& operator<<(ostream& sout, const SentinelList<DataType>& x)-
+//			Outputs the list to the indicated output stream.
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_SENTINEL_LIST_H
+#define DL_CDLL_SENTINEL_LIST_H
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class DataType, class Alloc = allocator<DataType> >
+	class SentinelList
+	{
+	public:
+		struct nodebase // the links of a list cell or of the sentinel
+		{
+			nodebase *next;
+			nodebase *prev;
+		};
+		// forward declarations:
+		struct listelem;
+		class iterator;
+
+		// constructors
+		SentinelList() : m_size(0) { reset(); }
+		explicit SentinelList(const Alloc& alloc)
+			: m_size(0), m_alloc(alloc) { reset(); }
+		SentinelList(size_t n_elements, DataType datum,
+			const Alloc& alloc = Alloc());
+		SentinelList(const SentinelList& x);
+		SentinelList(SentinelList&& x) noexcept;
+
+		// Destructor
+		~SentinelList() { release(); }
+
+		// Public methods:
+		unsigned getSize() const { return m_size; }
+		iterator begin() const
+			{ return empty() ? iterator() : iterator(head(), &m_sentinel); }
+		iterator end() const
+			{ return empty() ? iterator() : iterator(tail(), &m_sentinel); }
+		bool empty() const { return m_sentinel.next == &m_sentinel; }
+		void push_front(const DataType& datum)
+			{ link_before(m_sentinel.next, create_node(datum)); }
+		void push_front(DataType&& datum)
+			{ link_before(m_sentinel.next, create_node(std::move(datum))); }
+		void push_back(const DataType& datum)
+			{ link_before(&m_sentinel, create_node(datum)); }
+		void push_back(DataType&& datum)
+			{ link_before(&m_sentinel, create_node(std::move(datum))); }
+		template<class... Args>
+		DataType& emplace_front(Args&&... args)
+		{
+			listelem* node = create_node(std::forward<Args>(args)...);
+			link_before(m_sentinel.next, node);
+			return node->data;
+		}
+		template<class... Args>
+		DataType& emplace_back(Args&&... args)
+		{
+			listelem* node = create_node(std::forward<Args>(args)...);
+			link_before(&m_sentinel, node);
+			return node->data;
+		}
+		DataType pop_front();
+		DataType pop_back();
+		DataType& front() const;
+		DataType& back() const;
+		void release();
+		SentinelList& operator=(const SentinelList& rlist);
+		SentinelList& operator=(SentinelList&& rlist);
+		Alloc get_allocator() const { return Alloc(m_alloc); }
+	private:
+		typedef typename allocator_traits<Alloc>::template
+			rebind_alloc<listelem> node_allocator;
+		typedef allocator_traits<node_allocator> node_traits;
+
+		listelem* head() const
+			{ return static_cast<listelem*>(m_sentinel.next); }
+		listelem* tail() const
+			{ return static_cast<listelem*>(m_sentinel.prev); }
+		void reset() { m_sentinel.next = m_sentinel.prev = &m_sentinel; }
+		void take(SentinelList& x);
+		template<class... Args>
+		listelem* create_node(Args&&... args);
+		void destroy_node(listelem* node);
+		void link_before(nodebase* pos, nodebase* node)
+		{
+			node->next = pos;
+			node->prev = pos->prev;
+			pos->prev->next = node;
+			pos->prev = node;
+			m_size++;
+		}
+		listelem* unlink(nodebase* node)
+		{
+			node->prev->next = node->next;
+			node->next->prev = node->prev;
+			m_size--;
+			return static_cast<listelem*>(node);
+		}
+
+		// Properties:
+		nodebase m_sentinel;
+		unsigned m_size; // number of elements in the list
+		node_allocator m_alloc; // allocates and frees each listelem
+	public:
+		struct listelem : nodebase // list cell
+		{
+			DataType data;
+			template<class... Args>
+			listelem(Args&&... args) : data(std::forward<Args>(args)...) {}
+		};
+		class iterator
+		{
+		public:
+			iterator(nodebase* p = nullptr, const nodebase* s = nullptr)
+				: ptr(p), sentinel(s) {}
+			// Prefix increment
+			iterator& operator++()
+			{
+				if (ptr == nullptr)
+					throw runtime_error
+					("Could not increment the iterator: nullptr pointer");
+				ptr = ptr->next;
+				if (ptr == sentinel)
+					ptr = ptr->next;
+				return *this;
+			}
+			// Prefix decrement
+			iterator& operator--()
+			{
+				if (ptr == nullptr)
+					throw runtime_error
+					("Could not decrement the iterator: nullptr pointer");
+				ptr = ptr->prev;
+				if (ptr == sentinel)
+					ptr = ptr->prev;
+				return *this;
+			}
+			// Postfix increment
+			iterator operator++(int)
+			{
+				iterator temp = *this;
+				++*this;
+				return temp;
+			}
+			// Postfix decrement
+			iterator operator--(int)
+			{
+				iterator temp = *this;
+				--*this;
+				return temp;
+			}
+			listelem* operator->() const
+				{ return static_cast<listelem*>(ptr); }
+			DataType& operator*() const
+			{
+				if (ptr == nullptr)
+					throw runtime_error
+					("Could not retrieve data from an empty list.");
+				else return static_cast<listelem*>(ptr)->data; }
+			bool operator==(const iterator& rhs) const
+				{ return ptr == rhs.ptr; }
+			bool operator!=(const iterator& rhs) const
+				{ return ptr != rhs.ptr; }
+		private:
+			nodebase* ptr; //current node or nullptr
+			const nodebase* sentinel; //the node to step over
+		};	// End SentinelList::iterator class declarations.
+	}; // End SentinelList class declarations.
+
+	template <class DataType, class Alloc>
+	ostream& operator<<(ostream& sout, const SentinelList<DataType, Alloc>& x);
+
+	// Definitions for the SentinelList class now follow.
+
+	//------------------------------------------------------------------------
+	//	Method:			SentinelList<DataType>::SentinelList
+	//						(size_t n_elements, DataType datum,
+	//						const Alloc& alloc)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor that fills the list with a quantity of
+	//						n_elements DataTypes.
+	//	Parameters:		size_t n_elements- the quantity of items to fill the
+	//						list with.
+	//					DataType datum- the data to fill the list with.
+	//					const Alloc& alloc- the allocator for the nodes.
+	//	Returns:		None
+	//	Calls:			push_back()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	SentinelList<DataType, Alloc>::SentinelList(size_t n_elements,
+		DataType datum, const Alloc& alloc)
+		: m_size(0), m_alloc(alloc)
+	{
+		reset();
+		if (n_elements <= 0)
+			throw out_of_range("Could not create List object: Empty list");
+		for (size_t i = 0; i < n_elements; ++i)
+			push_back(datum);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			SentinelList<DataType>::SentinelList
+	//						(const SentinelList& source)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Copy constructor
+	//	Parameters:		const SentinelList& source- the list to copy from.
+	//	Returns:		None
+	//	Calls:			push_back()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	SentinelList<DataType, Alloc>::SentinelList(const SentinelList& source)
+		: m_size(0),
+		m_alloc(node_traits::select_on_container_copy_construction
+			(source.m_alloc))
+	{
+		reset();
+		for (const nodebase* p = source.m_sentinel.next;
+			p != &source.m_sentinel; p = p->next)
+			push_back(static_cast<const listelem*>(p)->data);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			SentinelList<DataType>::SentinelList
+	//						(SentinelList&& source)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Move constructor.  Takes over source's nodes, leaving
+	//						source empty.
+	//	Parameters:		SentinelList&& source- the list to move from.
+	//	Returns:		None
+	//	Calls:			take()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, marking it
+	//										noexcept so that vector moves
+	//										lists instead of copying them.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	SentinelList<DataType, Alloc>::SentinelList(SentinelList&& source)
+		noexcept
+		: m_size(0), m_alloc(source.m_alloc)
+	{
+		take(source);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void SentinelList<DataType>::take(SentinelList& x)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves x's nodes onto this list's sentinel.  The ring
+	//						has to be re-pointed at the new sentinel, since
+	//						the sentinel lives inside the object.  This list
+	//						must be empty.
+	//	Parameters:		SentinelList& x- the list to take the nodes from.
+	//	Returns:		None
+	//	Calls:			reset()
+	//	Called by:		Move constructor
+	//					Move assignment
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	void SentinelList<DataType, Alloc>::take(SentinelList& x)
+	{
+		if (x.empty())
+		{
+			reset();
+			return;
+		}
+		m_sentinel.next = x.m_sentinel.next;
+		m_sentinel.prev = x.m_sentinel.prev;
+		m_sentinel.next->prev = &m_sentinel;
+		m_sentinel.prev->next = &m_sentinel;
+		m_size = x.m_size;
+		x.reset();
+		x.m_size = 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void SentinelList<DataType>::release()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	empties the list
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			destroy_node()
+	//	Called by:		~SentinelList() (the destructor)
+	//					operator=
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	void SentinelList<DataType, Alloc>::release()
+	{
+		nodebase* p = m_sentinel.next;
+		while (p != &m_sentinel)
+		{
+			nodebase* next = p->next;
+			destroy_node(static_cast<listelem*>(p));
+			p = next;
+		}
+		reset();
+		m_size = 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			SentinelList<DataType>& SentinelList<DataType>::
+	//						operator=(const SentinelList& rlist)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Sets the contents of this list to those of rlist.
+	//						Once this list's nodes have gone back to its own
+	//						allocator, it takes rlist's allocator if that
+	//						propagates on copy assignment.
+	//	Parameters:		const SentinelList& rlist- the list to copy from.
+	//	Returns:		A reference to this list.
+	//	Calls:			release()
+	//					push_back()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, honouring
+	//										propagate_on_container_copy_
+	//										assignment.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	SentinelList<DataType, Alloc>& SentinelList<DataType, Alloc>::operator=
+		(const SentinelList& rlist)
+	{
+		if (&rlist != this)
+		{
+			release();
+			if (node_traits::propagate_on_container_copy_assignment::value)
+				m_alloc = rlist.m_alloc;
+			for (const nodebase* p = rlist.m_sentinel.next;
+				p != &rlist.m_sentinel; p = p->next)
+				push_back(static_cast<const listelem*>(p)->data);
+		}
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			SentinelList<DataType>& SentinelList<DataType>::
+	//						operator=(SentinelList&& rlist)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Move assignment.  Takes over rlist's nodes when the
+	//						two allocators can free each other's nodes;
+	//						otherwise moves the data over one element at a
+	//						time.  rlist is left empty either way.
+	//	Parameters:		SentinelList&& rlist- the list to move from.
+	//	Returns:		A reference to this list.
+	//	Calls:			release()
+	//					take()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	SentinelList<DataType, Alloc>& SentinelList<DataType, Alloc>::operator=
+		(SentinelList&& rlist)
+	{
+		if (&rlist != this)
+		{
+			release();
+			if (node_traits::propagate_on_container_move_assignment::value)
+				m_alloc = rlist.m_alloc;
+			if (m_alloc == rlist.m_alloc)
+				take(rlist);
+			else
+			{
+				while (!rlist.empty())
+					push_back(rlist.pop_front());
+			}
+		}
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType SentinelList<DataType>::pop_front()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	removes front element and returns the data from that
+	//						element, moved out
+	//	Parameters:		None
+	//	Returns:		A DataType equal to the item being popped.
+	//	Calls:			unlink()
+	//					destroy_node()
+	//	Called by:		Move assignment
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	DataType SentinelList<DataType, Alloc>::pop_front()
+	{
+		if (empty())
+			throw runtime_error("Could not remove front item: Empty list");
+		listelem* node = unlink(m_sentinel.next);
+		DataType data = std::move(node->data);
+		destroy_node(node);
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType SentinelList<DataType>::pop_back()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	removes back element and returns the data from that
+	//						element, moved out
+	//	Parameters:		None
+	//	Returns:		A DataType equal to the item being popped.
+	//	Calls:			unlink()
+	//					destroy_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	DataType SentinelList<DataType, Alloc>::pop_back()
+	{
+		if (empty())
+			throw runtime_error
+			("Could not remove item from the back: Empty list");
+		listelem* node = unlink(m_sentinel.prev);
+		DataType data = std::move(node->data);
+		destroy_node(node);
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& SentinelList<DataType>::front() const
+	//	Version:		1.0
+	//	Date:			10/17/2026
+	//	Description:	Returns the data value within the head.
+	//	Parameters:		None
+	//	Returns:		The head's data
+	//	Calls:			empty()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog:		10/17/2026	DL	completed version 1.0
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	DataType& SentinelList<DataType, Alloc>::front() const
+	{
+		if (empty())
+			throw runtime_error
+			("Could not access the front value of an empty list.");
+		return head()->data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& SentinelList<DataType>::back() const
+	//	Version:		1.0
+	//	Date:			10/17/2026
+	//	Description:	Returns the data value within the tail.
+	//	Parameters:		None
+	//	Returns:		The tail's data
+	//	Calls:			empty()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog:		10/17/2026	DL	completed version 1.0
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	DataType& SentinelList<DataType, Alloc>::back() const
+	{
+		if (empty())
+			throw runtime_error
+			("Could not access the back value of an empty list.");
+		return tail()->data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			listelem* SentinelList<DataType>::create_node
+	//						(Args&&... args)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Allocates a node through the list's allocator and
+	//						constructs its data in place from args.
+	//	Parameters:		Args&&... args- the arguments for DataType's
+	//						constructor.
+	//	Returns:		A pointer to the new, unlinked node.
+	//	Calls:			listelem struct constructor
+	//	Called by:		push_front(); push_back();
+	//					emplace_front(); emplace_back()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  No memory is leaked either way.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	template <class... Args>
+	typename SentinelList<DataType, Alloc>::listelem*
+		SentinelList<DataType, Alloc>::create_node(Args&&... args)
+	{
+		listelem* node = node_traits::allocate(m_alloc, 1);
+		try
+		{
+			node_traits::construct(m_alloc, node,
+				std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(m_alloc, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void SentinelList<DataType>::destroy_node
+	//						(listelem* node)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destroys a node and returns its memory to the list's
+	//						allocator.
+	//	Parameters:		listelem* node- the node to free.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		pop_front(); pop_back(); release()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	void SentinelList<DataType, Alloc>::destroy_node(listelem* node)
+	{
+		node_traits::destroy(m_alloc, node);
+		node_traits::deallocate(m_alloc, node, 1);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		ostream& operator<<
+	//						(ostream& sout, const SentinelList<DataType>& x)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	prints out a list
+	//	Parameters:		ostream& sout- A reference to the output stream.
+	//					const SentinelList<DataType>& x- A reference to the
+	//						item to be printed.
+	//	Returns:		The ostream&
+	//	Calls:			begin()
+	//					getSize()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			The data contents of the list.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	ostream& operator<<(ostream& sout, const SentinelList<DataType, Alloc>& x)
+	{
+		typename SentinelList<DataType, Alloc>::iterator q = x.begin();
+		sout << "(";
+		for (unsigned i = 0; i < x.getSize(); ++i, ++q)
+		{
+			if (i > 0)
+				sout << ",";
+			sout << *q;
+		}
+		sout << ")\n";
+		return sout;
+	}
+} // End DL_CDLL namespace.
+
+#endif
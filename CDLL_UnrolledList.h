@@ -0,0 +1,861 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_UnrolledList.h
+//
+//	Class:			UnrolledList
+//
+//	Title:			Unrolled Circular Doubly-Linked List
+//
+//	Description:	This file contains the class definitions for the
+//						UnrolledList Template Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class UnrolledList:
+//		Description:
+//			A circular doubly-linked list whose nodes (chunks) each hold up
+//				to N elements in a contiguous block, instead of one element
+//				per node as in List.  The two link pointers and the
+//				allocation are shared by up to N elements, and stepping
+//				through a chunk touches consecutive memory.  Each chunk
+//				keeps its elements in the slots from first through
+//				first + count - 1, so the head chunk fills downward from
+//				the end of its block on push_front and the tail chunk fills
+//				upward on push_back; a chunk is allocated only when the end
+//				chunk is full and freed as soon as it is empty.  The tail
+//				chunk's next is the head chunk, and iterating past the last
+//				element wraps around to the first as it does in List.
+//
+//		Properties:
+//			chunk* head-		The chunk holding the front element.
+//			chunk* tail-		The chunk holding the back element.  Its
+//									next chunk is head.
+//			unsigned m_size-	The number of elements in the list.
+//			chunk_allocator m_alloc- The allocator, rebound from Alloc to
+//									chunk, that every chunk is allocated from.
+//
+//		Classes and structs contained within:
+//			chunk-			One node of the ring.
+//				Properties:
+//						chunk *next, *prev- The neighboring chunks.
+//						unsigned first- The slot of the chunk's first element.
+//						unsigned count- The number of elements in the chunk.
+//						storage- Raw, aligned room for N DataTypes.
+//				Method:
+//						DataType* slot(unsigned s)- The address of slot s.
+//			iterator-		The iterator class.  Holds a chunk and the
+//								position of an element within it.
+//
+//		Methods:
+//			The constructors, push_front(), push_back(), emplace_front(),
+//				emplace_back(), pop_front(), pop_back(), front(), back(),
+//				begin(), end(), getSize(), empty(), release(), operator=,
+//				operator[] and get_allocator() behave as they do in List.
+//				operator[] skips whole chunks, so it costs O(n / N).
+//			chunk* new_chunk(unsigned first)- Allocates an empty chunk.
+//				(private)
+//			void free_chunk(chunk* c)- Unlinks and frees an empty chunk.
+//				(private)
+//
+//	Functions:
+//		ostream& operator<<(ostream& sout, const UnrolledList<DataType>& x)-
+//			Outputs the list to the indicated output stream.
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_UNROLLED_LIST_H
+#define DL_CDLL_UNROLLED_LIST_H
+
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class DataType, size_t N = 16,
+		class Alloc = allocator<DataType> >
+	class UnrolledList
+	{
+		static_assert(N > 0, "UnrolledList needs room for one element");
+	public:
+		struct chunk // one node of the ring, holding up to N elements
+		{
+			chunk *next;
+			chunk *prev;
+			unsigned first; // slot of the first element
+			unsigned count; // number of elements
+			alignas(DataType) unsigned char storage[N * sizeof(DataType)];
+			DataType* slot(unsigned s)
+				{ return reinterpret_cast<DataType*>(storage) + s; }
+		};
+		class iterator;
+
+		// constructors
+		UnrolledList() : head(nullptr), tail(nullptr), m_size(0) {}
+		explicit UnrolledList(const Alloc& alloc)
+			: head(nullptr), tail(nullptr), m_size(0), m_alloc(alloc) {}
+		UnrolledList(size_t n_elements, DataType datum,
+			const Alloc& alloc = Alloc());
+		UnrolledList(const UnrolledList& x);
+		UnrolledList(UnrolledList&& x) noexcept;
+
+		// Destructor
+		~UnrolledList() { release(); }
+
+		// Public methods:
+		unsigned getSize() const { return m_size; }
+		iterator begin() const { return iterator(head, 0); }
+		iterator end() const
+			{ return tail == nullptr ? iterator() :
+				iterator(tail, tail->count - 1); }
+		bool empty() const { return head == nullptr; }
+		void push_front(const DataType& datum) { emplace_front(datum); }
+		void push_front(DataType&& datum) { emplace_front(std::move(datum)); }
+		void push_back(const DataType& datum) { emplace_back(datum); }
+		void push_back(DataType&& datum) { emplace_back(std::move(datum)); }
+		template<class... Args>
+		DataType& emplace_front(Args&&... args);
+		template<class... Args>
+		DataType& emplace_back(Args&&... args);
+		DataType pop_front();
+		DataType pop_back();
+		DataType& front() const;
+		DataType& back() const;
+		void release();
+		UnrolledList& operator=(const UnrolledList& rlist);
+		UnrolledList& operator=(UnrolledList&& rlist);
+		DataType& operator[](int index);
+		const DataType& operator[](int index) const;
+		Alloc get_allocator() const { return Alloc(m_alloc); }
+	private:
+		typedef typename allocator_traits<Alloc>::template
+			rebind_alloc<chunk> chunk_allocator;
+		typedef allocator_traits<chunk_allocator> chunk_traits;
+
+		chunk* new_chunk(unsigned first);
+		void free_chunk(chunk* c);
+		DataType* find(int index) const;
+
+		// Properties:
+		chunk *head;
+		chunk *tail;
+		unsigned m_size; // number of elements in the list
+		chunk_allocator m_alloc; // allocates and frees each chunk
+	public:
+		class iterator
+		{
+		public:
+			iterator(chunk* c = nullptr, unsigned i = 0) : ptr(c), pos(i){}
+			// Prefix increment
+			iterator operator++()
+			{
+				if (ptr == nullptr)
+					throw runtime_error
+					("Could not increment the iterator: nullptr pointer");
+				if (++pos == ptr->count)
+				{
+					ptr = ptr->next;
+					pos = 0;
+				}
+				return *this;
+			}
+			// Prefix decrement
+			iterator operator--()
+			{
+				if (ptr == nullptr)
+					throw runtime_error
+					("Could not decrement the iterator: nullptr pointer");
+				if (pos == 0)
+				{
+					ptr = ptr->prev;
+					pos = ptr->count;
+				}
+				--pos;
+				return *this;
+			}
+			// Postfix increment
+			iterator operator++(int)
+			{
+				iterator temp = *this;
+				++*this;
+				return temp;
+			}
+			// Postfix decrement
+			iterator operator--(int)
+			{
+				iterator temp = *this;
+				--*this;
+				return temp;
+			}
+			DataType* operator->() const { return &**this; }
+			DataType& operator*() const
+			{
+				if (ptr == nullptr)
+					throw runtime_error
+					("Could not retrieve data from an empty list.");
+				else return *ptr->slot(ptr->first + pos); }
+			bool operator==(const iterator& rhs) const
+				{ return ptr == rhs.ptr && pos == rhs.pos; }
+			bool operator!=(const iterator& rhs) const
+				{ return !(*this == rhs); }
+		private:
+			chunk* ptr; //current chunk or nullptr
+			unsigned pos; //element within the chunk
+		};	// End UnrolledList::iterator class declarations.
+	}; // End UnrolledList class declarations.
+
+	template <class DataType, size_t N, class Alloc>
+	ostream& operator<<(ostream& sout,
+		const UnrolledList<DataType, N, Alloc>& x);
+
+	// Definitions for the UnrolledList class now follow.
+
+	//------------------------------------------------------------------------
+	//	Method:			UnrolledList<DataType>::UnrolledList
+	//						(size_t n_elements, DataType datum,
+	//						const Alloc& alloc)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Constructor that fills the list with a quantity of
+	//						n_elements DataTypes.
+	//	Parameters:		size_t n_elements- the quantity of items to fill the
+	//						list with.
+	//					DataType datum- the data to fill the list with.
+	//					const Alloc& alloc- the allocator for the chunks.
+	//	Returns:		None
+	//	Calls:			push_back()
+	//					release()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range, bad_alloc, or whatever DataType's
+	//						copy constructor throws.  The chunks built so
+	//						far are freed if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, freeing the
+	//										chunks built so far when a
+	//										copy or an allocation throws.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	UnrolledList<DataType, N, Alloc>::UnrolledList(size_t n_elements,
+		DataType datum, const Alloc& alloc)
+		: head(nullptr), tail(nullptr), m_size(0), m_alloc(alloc)
+	{
+		if (n_elements <= 0)
+			throw out_of_range("Could not create List object: Empty list");
+		try
+		{
+			for (size_t i = 0; i < n_elements; ++i)
+				push_back(datum);
+		}
+		catch (...)
+		{ // the destructor will not run for a half-built list
+			release();
+			throw;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			UnrolledList<DataType>::UnrolledList
+	//						(const UnrolledList& source)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Copy constructor
+	//	Parameters:		const UnrolledList& source- the list to copy from.
+	//	Returns:		None
+	//	Calls:			push_back()
+	//					release()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's copy constructor
+	//						throws.  The chunks built so far are freed if
+	//						it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, freeing the
+	//										chunks built so far when a
+	//										copy or an allocation throws.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	UnrolledList<DataType, N, Alloc>::UnrolledList(const UnrolledList& source)
+		: head(nullptr), tail(nullptr), m_size(0),
+		m_alloc(chunk_traits::select_on_container_copy_construction
+			(source.m_alloc))
+	{
+		try
+		{
+			iterator r_it = source.begin();
+			for (unsigned i = 0; i < source.m_size; i++)
+				push_back(*r_it++);
+		}
+		catch (...)
+		{ // the destructor will not run for a half-built list
+			release();
+			throw;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			UnrolledList<DataType>::UnrolledList
+	//						(UnrolledList&& source)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Move constructor.  Takes over source's chunks, leaving
+	//						source empty.
+	//	Parameters:		UnrolledList&& source- the list to move from.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, marking it
+	//										noexcept so that vector moves
+	//										lists instead of copying them.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	UnrolledList<DataType, N, Alloc>::UnrolledList(UnrolledList&& source)
+		noexcept
+		: head(source.head), tail(source.tail), m_size(source.m_size),
+		m_alloc(source.m_alloc)
+	{
+		source.head = source.tail = nullptr;
+		source.m_size = 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			UnrolledList<DataType>& UnrolledList<DataType>::
+	//						operator=(const UnrolledList& rlist)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Sets the contents of this list to those of rlist.
+	//						Once this list's chunks have gone back to its
+	//						own allocator, it takes rlist's allocator if
+	//						that propagates on copy assignment.
+	//	Parameters:		const UnrolledList& rlist- the list to copy from.
+	//	Returns:		A reference to this list.
+	//	Calls:			release()
+	//					push_back()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, honouring
+	//										propagate_on_container_copy_
+	//										assignment.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	UnrolledList<DataType, N, Alloc>& UnrolledList<DataType, N, Alloc>::
+		operator=(const UnrolledList& rlist)
+	{
+		if (&rlist != this)
+		{
+			release();
+			if (chunk_traits::propagate_on_container_copy_assignment::value)
+				m_alloc = rlist.m_alloc;
+			iterator r_it = rlist.begin();
+			for (unsigned i = 0; i < rlist.m_size; i++)
+				push_back(*r_it++);
+		}
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			UnrolledList<DataType>& UnrolledList<DataType>::
+	//						operator=(UnrolledList&& rlist)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Move assignment.  Takes over rlist's chunks when the
+	//						two allocators can free each other's chunks;
+	//						otherwise moves the data over one element at a
+	//						time.  rlist is left empty either way.
+	//	Parameters:		UnrolledList&& rlist- the list to move from.
+	//	Returns:		A reference to this list.
+	//	Calls:			release()
+	//					push_back()
+	//					pop_front()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	UnrolledList<DataType, N, Alloc>& UnrolledList<DataType, N, Alloc>::
+		operator=(UnrolledList&& rlist)
+	{
+		if (&rlist != this)
+		{
+			release();
+			if (chunk_traits::propagate_on_container_move_assignment::value)
+				m_alloc = rlist.m_alloc;
+			if (m_alloc == rlist.m_alloc)
+			{ // the chunks can change hands
+				head = rlist.head;
+				tail = rlist.tail;
+				m_size = rlist.m_size;
+				rlist.head = rlist.tail = nullptr;
+				rlist.m_size = 0;
+			}
+			else
+			{
+				while (!rlist.empty())
+					push_back(rlist.pop_front());
+			}
+		}
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void UnrolledList<DataType>::release()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	empties the list, destroying every element and
+	//						freeing every chunk
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			free_chunk()
+	//	Called by:		~UnrolledList() (the destructor)
+	//					Fill and copy constructors
+	//					operator=
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	void UnrolledList<DataType, N, Alloc>::release()
+	{
+		while (head != nullptr)
+		{
+			for (unsigned i = 0; i < head->count; i++)
+				head->slot(head->first + i)->~DataType();
+			head->count = 0;
+			free_chunk(head);
+		}
+		m_size = 0;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& UnrolledList<DataType>::emplace_front
+	//						(Args&&... args)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Adds an element at the front of the list,
+	//						constructing it in place.  A new chunk is only
+	//						needed when the head chunk has no free slot ahead
+	//						of its first element.
+	//	Parameters:		Args&&... args- the arguments for DataType's
+	//						constructor.
+	//	Returns:		A reference to the new element.
+	//	Calls:			new_chunk()
+	//					free_chunk()
+	//	Called by:		push_front()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  The list is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	template <class... Args>
+	DataType& UnrolledList<DataType, N, Alloc>::emplace_front(Args&&... args)
+	{
+		chunk* c = head;
+		bool fresh = (c == nullptr || c->first == 0);
+		if (fresh)
+		{ // the new chunk fills downward from its last slot
+			c = new_chunk(N);
+			if (head == nullptr)
+				tail = c;
+			head = c;
+		}
+		try
+		{
+			::new (static_cast<void*>(c->slot(c->first - 1)))
+				DataType(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			if (fresh)
+				free_chunk(c);
+			throw;
+		}
+		c->first--;
+		c->count++;
+		m_size++;
+		return *c->slot(c->first);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& UnrolledList<DataType>::emplace_back
+	//						(Args&&... args)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Adds an element at the back of the list,
+	//						constructing it in place.  A new chunk is only
+	//						needed when the tail chunk has no free slot after
+	//						its last element.
+	//	Parameters:		Args&&... args- the arguments for DataType's
+	//						constructor.
+	//	Returns:		A reference to the new element.
+	//	Calls:			new_chunk()
+	//					free_chunk()
+	//	Called by:		push_back()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  The list is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	template <class... Args>
+	DataType& UnrolledList<DataType, N, Alloc>::emplace_back(Args&&... args)
+	{
+		chunk* c = tail;
+		bool fresh = (c == nullptr || c->first + c->count == N);
+		if (fresh)
+		{ // the new chunk fills upward from its first slot
+			c = new_chunk(0);
+			if (tail == nullptr)
+				head = c;
+			tail = c;
+		}
+		try
+		{
+			::new (static_cast<void*>(c->slot(c->first + c->count)))
+				DataType(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			if (fresh)
+				free_chunk(c);
+			throw;
+		}
+		c->count++;
+		m_size++;
+		return *c->slot(c->first + c->count - 1);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType UnrolledList<DataType>::pop_front()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	removes front element and returns it, moved out.
+	//						The head chunk is freed once it is empty.
+	//	Parameters:		None
+	//	Returns:		A DataType equal to the item being popped.
+	//	Calls:			free_chunk()
+	//	Called by:		Move assignment
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	DataType UnrolledList<DataType, N, Alloc>::pop_front()
+	{
+		if (head == nullptr)
+			throw runtime_error("Could not remove front item: Empty list");
+		chunk* c = head;
+		DataType* item = c->slot(c->first);
+		DataType data = std::move(*item);
+		item->~DataType();
+		c->first++;
+		c->count--;
+		m_size--;
+		if (c->count == 0)
+			free_chunk(c);
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType UnrolledList<DataType>::pop_back()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	removes back element and returns it, moved out.
+	//						The tail chunk is freed once it is empty.
+	//	Parameters:		None
+	//	Returns:		A DataType equal to the item being popped.
+	//	Calls:			free_chunk()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	DataType UnrolledList<DataType, N, Alloc>::pop_back()
+	{
+		if (tail == nullptr)
+			throw runtime_error
+			("Could not remove item from the back: Empty list");
+		chunk* c = tail;
+		DataType* item = c->slot(c->first + c->count - 1);
+		DataType data = std::move(*item);
+		item->~DataType();
+		c->count--;
+		m_size--;
+		if (c->count == 0)
+			free_chunk(c);
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& UnrolledList<DataType>::front() const
+	//	Version:		1.0
+	//	Date:			10/17/2026
+	//	Description:	Returns the front element.
+	//	Parameters:		None
+	//	Returns:		The front element
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog:		10/17/2026	DL	completed version 1.0
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	DataType& UnrolledList<DataType, N, Alloc>::front() const
+	{
+		if (head == nullptr)
+			throw runtime_error
+			("Could not access the front value of an empty list.");
+		return *head->slot(head->first);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& UnrolledList<DataType>::back() const
+	//	Version:		1.0
+	//	Date:			10/17/2026
+	//	Description:	Returns the back element.
+	//	Parameters:		None
+	//	Returns:		The back element
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog:		10/17/2026	DL	completed version 1.0
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	DataType& UnrolledList<DataType, N, Alloc>::back() const
+	{
+		if (tail == nullptr)
+			throw runtime_error
+			("Could not access the back value of an empty list.");
+		return *tail->slot(tail->first + tail->count - 1);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& UnrolledList<DataType>::operator[]
+	//						(int index)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	[] operator -- Modifiable l-value
+	//	Parameters:		int index- the index of the desired item.  Negative
+	//						indices count back from the back element.
+	//	Returns:		A reference to the item.
+	//	Calls:			find()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	DataType& UnrolledList<DataType, N, Alloc>::operator[](int index)
+	{
+		return *find(index);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			const DataType& UnrolledList<DataType>::operator[]
+	//						(int index) const
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	[] operator -- Non-modifiable r-value
+	//	Parameters:		int index- the index of the desired item.  Negative
+	//						indices count back from the back element.
+	//	Returns:		A const reference to the item.
+	//	Calls:			find()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	const DataType& UnrolledList<DataType, N, Alloc>::operator[](int index)
+		const
+	{
+		return *find(index);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType* UnrolledList<DataType>::find(int index)
+	//						const
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Finds the element at index by skipping whole chunks
+	//						from whichever end is closer.
+	//	Parameters:		int index- the index of the desired item.
+	//	Returns:		A pointer to the item.
+	//	Calls:			None
+	//	Called by:		operator[]
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	DataType* UnrolledList<DataType, N, Alloc>::find(int index) const
+	{
+		int size = static_cast<int>(m_size);
+		if (index < 0)
+		{
+			if (index < -size)
+				throw out_of_range("index out-of-range");
+			index = size + index;
+		}
+		else if (index >= size)
+			throw out_of_range("index out-of-range");
+		unsigned i = static_cast<unsigned>(index);
+		chunk* c;
+		if (i < m_size / 2)
+		{
+			c = head;
+			while (i >= c->count)
+			{
+				i -= c->count;
+				c = c->next;
+			}
+		}
+		else
+		{
+			c = tail;
+			unsigned back = m_size - 1 - i; // distance from the back
+			while (back >= c->count)
+			{
+				back -= c->count;
+				c = c->prev;
+			}
+			i = c->count - 1 - back;
+		}
+		return c->slot(c->first + i);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			chunk* UnrolledList<DataType>::new_chunk
+	//						(unsigned first)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Allocates an empty chunk.  When the list is empty the
+	//						chunk becomes a ring of one; otherwise it is
+	//						linked in between the tail and the head, and the
+	//						caller makes it the new head or tail.
+	//	Parameters:		unsigned first- where the chunk's first element
+	//						will go (0 to fill upward, N to fill downward).
+	//	Returns:		A pointer to the chunk.
+	//	Calls:			None
+	//	Called by:		emplace_front()
+	//					emplace_back()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	typename UnrolledList<DataType, N, Alloc>::chunk*
+		UnrolledList<DataType, N, Alloc>::new_chunk(unsigned first)
+	{
+		chunk* c = chunk_traits::allocate(m_alloc, 1);
+		c->first = first;
+		c->count = 0;
+		if (head == nullptr)
+			c->next = c->prev = c;
+		else
+		{
+			c->prev = tail;
+			c->next = head;
+			tail->next = c;
+			head->prev = c;
+		}
+		return c;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void UnrolledList<DataType>::free_chunk(chunk* c)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Unlinks an empty chunk from the ring and frees it,
+	//						moving head or tail off of it if needed.
+	//	Parameters:		chunk* c- the chunk to free.  It must hold no
+	//						elements.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		pop_front(); pop_back(); release();
+	//					emplace_front(); emplace_back()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	void UnrolledList<DataType, N, Alloc>::free_chunk(chunk* c)
+	{
+		if (c->next == c)
+			head = tail = nullptr;
+		else
+		{
+			c->prev->next = c->next;
+			c->next->prev = c->prev;
+			if (c == head)
+				head = c->next;
+			if (c == tail)
+				tail = c->prev;
+		}
+		chunk_traits::deallocate(m_alloc, c, 1);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		ostream& operator<<
+	//						(ostream& sout, const UnrolledList<DataType>& x)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	prints out a list
+	//	Parameters:		ostream& sout- A reference to the output stream.
+	//					const UnrolledList<DataType>& x- A reference to the
+	//						item to be printed.
+	//	Returns:		The ostream&
+	//	Calls:			begin()
+	//					getSize()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			The data contents of the list.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, size_t N, class Alloc>
+	ostream& operator<<(ostream& sout,
+		const UnrolledList<DataType, N, Alloc>& x)
+	{
+		typename UnrolledList<DataType, N, Alloc>::iterator q = x.begin();
+		sout << "(";
+		for (unsigned i = 0; i < x.getSize(); ++i, ++q)
+		{
+			if (i > 0)
+				sout << ",";
+			sout << *q;
+		}
+		sout << ")\n";
+		return sout;
+	}
+} // End DL_CDLL namespace.
+
+#endif
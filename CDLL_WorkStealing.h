@@ -0,0 +1,792 @@
+//----------------------------------------------------------------------------
+//	File:			CDLL_WorkStealing.h
+//
+//	Class:			WorkStealingDeque
+//					WorkStealingPool
+//
+//	Title:			Chase-Lev Work-Stealing Deque and Thread Pool
+//
+//	Description:	This file contains the class definitions for the
+//						WorkStealingDeque Template Class and the
+//						WorkStealingPool Class.
+//
+//	Programmer:		David Landry
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.0
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class WorkStealingDeque:
+//		Description:
+//			A Chase-Lev deque, with the memory orderings of Le, Pop, Cohen
+//				and Zappa Nardelli (PPoPP 2013).  One owner thread pushes
+//				and pops at the back, like a stack, and any number of thief
+//				threads steal from the front.  The owner's end takes no
+//				lock and, unless one element is left, no read-modify-write.
+//				Thieves settle races with a single compare-and-swap on top.
+//				The method names are those of List: push_back(), pop_back()
+//				and pop_front().
+//
+//			The elements sit in a ring of atomic slots that doubles when it
+//				fills.  A thief may still be reading the old ring, so old
+//				rings are kept until the deque is destroyed.  DataType must
+//				be trivially copyable, as a task pointer is.
+//
+//		Properties:
+//			atomic<long long> m_top- The index of the front element.
+//							Thieves advance it.
+//			atomic<long long> m_bottom- One past the back element.  Only
+//							the owner writes it.  Padding keeps m_top and
+//							m_bottom on cache lines of their own.
+//			atomic<ring*> m_ring- The current ring.
+//			slot_allocator m_slotAlloc, ring_allocator m_ringAlloc- Alloc
+//							rebound to the slots and to ring.
+//
+//		Classes and structs contained within:
+//			ring-			One array of slots.
+//				Properties:
+//						atomic<DataType>* slots- 2^n slots; index i lives
+//							in slots[i & mask].
+//						size_t mask- The slot count - 1.
+//						ring* previous- The ring this one replaced.
+//
+//		Methods:
+//			explicit WorkStealingDeque(size_t capacity, const Alloc& alloc)-
+//				Constructor.  The first ring has at least capacity slots.
+//				Throws out_of_range for a capacity of 0.
+//			~WorkStealingDeque()- Frees every ring.
+//			void push_back(const DataType& datum)- Adds an element at the
+//				back, growing the ring if it is full.  Owner only.
+//			DataType pop_back()- Removes and returns the back element.
+//				Throws runtime_error if the deque is empty.  Owner only.
+//			bool try_pop_back(DataType& out)- Moves the back element into
+//				out and returns true, or returns false if the deque is
+//				empty.  Owner only.
+//			DataType pop_front()- Steals the front element, retrying when
+//				another thread wins it first.  Throws runtime_error if the
+//				deque is empty.  Any thread.
+//			bool try_pop_front(DataType& out)- Steals the front element into
+//				out and returns true.  Returns false if the deque is empty
+//				or another thread took the element first.  Any thread.
+//			bool empty() const, unsigned getSize() const- The element count,
+//				which may already be stale when another thread is working
+//				on the deque.
+//			size_t capacity() const- The current ring's slot count.
+//			ring* grow(ring* old, long long top, long long bottom)- Copies
+//				the elements into a ring twice the size.  (private)
+//			ring* make_ring(size_t slots, ring* previous)- Allocates a ring.
+//				(private)
+//
+//	Class WorkStealingPool:
+//		Description:
+//			A fixed set of worker threads, each owning a
+//				WorkStealingDeque of tasks.  A task submitted from inside a
+//				task goes on the back of its worker's own deque, so
+//				recursive work stays on one thread and in cache.  A task
+//				submitted from any other thread goes on a shared
+//				ConcurrentQueue.  A worker runs the back of its own deque
+//				first, then the shared queue, and then steals from the front
+//				of the other workers' deques, which is where their oldest,
+//				and usually largest, tasks are.  Idle workers sleep until a
+//				task is submitted.
+//
+//		Properties:
+//			vector<unique_ptr<worker> > m_workers- One per thread.
+//			vector<thread> m_threads- The worker threads.
+//			ConcurrentQueue<task*> m_injected- Tasks from outside the pool.
+//			atomic<long> m_queued- Tasks waiting to start.
+//			atomic<long> m_pending- Tasks submitted and not yet finished.
+//			atomic<unsigned> m_sleeping- Workers asleep, or about to be.
+//			atomic<bool> m_stopping- Set by the destructor.
+//			exception_ptr m_error- The first exception a task threw.
+//			mutex m_lock- Guards m_error and the sleeping and waiting.
+//			condition_variable m_wake, m_done- Wake sleeping workers, and
+//							threads in wait().
+//
+//		Classes and structs contained within:
+//			worker-			One worker thread's state.
+//				Properties:
+//						WorkStealingDeque<task*> deque- Its tasks.
+//						WorkStealingPool* pool- The pool it belongs to.
+//
+//		Methods:
+//			explicit WorkStealingPool(unsigned threads)- Starts threads
+//				workers (0 means hardware_concurrency()).
+//			~WorkStealingPool()- Waits for every task, then stops the
+//				workers.
+//			void submit(Task task)- Queues task(), from any thread,
+//				including from inside a task.
+//			void wait()- Waits until every task submitted so far, and every
+//				task those submit, has finished, then rethrows the first
+//				exception a task threw, if any.  Not from inside a task.
+//			unsigned threads() const- The number of workers.
+//			bool take(worker* self, task*& t)- Finds a task to run.
+//				(private)
+//			void execute(task* t)- Runs and frees a task.  (private)
+//			void work(worker* self)- A worker thread's loop.  (private)
+//			worker*& current()- The calling thread's worker, if it is one.
+//				(private)
+//----------------------------------------------------------------------------
+#ifndef DL_CDLL_WORK_STEALING_H
+#define DL_CDLL_WORK_STEALING_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "CDLL_ConcurrentQueue.h"
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	template<class DataType, class Alloc = allocator<DataType> >
+	class WorkStealingDeque
+	{
+		static_assert(is_trivially_copyable<DataType>::value,
+			"WorkStealingDeque needs a trivially copyable DataType");
+	public:
+		explicit WorkStealingDeque(size_t capacity = 64,
+			const Alloc& alloc = Alloc());
+		~WorkStealingDeque();
+
+		void push_back(const DataType& datum);
+		DataType pop_back()
+		{
+			DataType datum;
+			if (!try_pop_back(datum))
+				throw runtime_error("Could not remove back item: Empty list");
+			return datum;
+		}
+		bool try_pop_back(DataType& out);
+		DataType pop_front();
+		bool try_pop_front(DataType& out);
+		bool empty() const { return getSize() == 0; }
+		unsigned getSize() const
+		{
+			long long size = m_bottom.load(memory_order_relaxed)
+				- m_top.load(memory_order_relaxed);
+			return size > 0 ? static_cast<unsigned>(size) : 0;
+		}
+		size_t capacity() const
+			{ return m_ring.load(memory_order_relaxed)->mask + 1; }
+	private:
+		struct ring
+		{
+			atomic<DataType>* slots;
+			size_t mask;
+			ring* previous;
+		};
+		typedef typename allocator_traits<Alloc>::template
+			rebind_alloc<atomic<DataType> > slot_allocator;
+		typedef typename allocator_traits<Alloc>::template
+			rebind_alloc<ring> ring_allocator;
+
+		WorkStealingDeque(const WorkStealingDeque&);
+		WorkStealingDeque& operator=(const WorkStealingDeque&);
+		ring* grow(ring* old, long long top, long long bottom);
+		ring* make_ring(size_t slots, ring* previous);
+
+		// The two ends are kept a cache line apart, and from whatever sits
+		// next to the deque, with padding rather than alignas(64): an
+		// over-aligned deque would not be aligned by plain new before
+		// C++17, and WorkStealingPool news one per worker.
+		static const size_t cache_line = 64;
+
+		// Properties:
+		char m_padBefore[cache_line];
+		atomic<long long> m_top; // thieves' end
+		char m_padTop[cache_line - sizeof(atomic<long long>)];
+		atomic<long long> m_bottom; // owner's end
+		char m_padBottom[cache_line - sizeof(atomic<long long>)];
+		atomic<ring*> m_ring;
+		slot_allocator m_slotAlloc;
+		ring_allocator m_ringAlloc;
+	}; // End WorkStealingDeque class declarations.
+
+	class WorkStealingPool
+	{
+		typedef function<void()> task;
+		struct worker
+		{
+			WorkStealingDeque<task*> deque;
+			WorkStealingPool* pool;
+		};
+	public:
+		explicit WorkStealingPool(unsigned threads = 0);
+		~WorkStealingPool();
+
+		template<class Task>
+		void submit(Task t);
+		void wait();
+		unsigned threads() const
+			{ return static_cast<unsigned>(m_threads.size()); }
+	private:
+		WorkStealingPool(const WorkStealingPool&);
+		WorkStealingPool& operator=(const WorkStealingPool&);
+		bool take(worker* self, task*& t);
+		void execute(task* t);
+		void work(worker* self);
+		static worker*& current()
+		{
+			static thread_local worker* self = nullptr;
+			return self;
+		}
+
+		// Properties:
+		vector<unique_ptr<worker> > m_workers;
+		vector<thread> m_threads;
+		ConcurrentQueue<task*> m_injected; // tasks from outside the pool
+		atomic<long> m_queued; // waiting to start
+		atomic<long> m_pending; // submitted and not yet finished
+		atomic<unsigned> m_sleeping;
+		atomic<bool> m_stopping;
+		exception_ptr m_error;
+		mutex m_lock;
+		condition_variable m_wake; // for sleeping workers
+		condition_variable m_done; // for wait()
+	}; // End WorkStealingPool class declarations.
+
+	//------------------------------------------------------------------------
+	//	Method:			WorkStealingDeque<DataType>::WorkStealingDeque
+	//						(size_t capacity, const Alloc& alloc)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor.  Allocates the first ring, rounding
+	//						capacity up to a power of 2.
+	//	Parameters:		size_t capacity- the least number of slots.
+	//					const Alloc& alloc- allocates the rings.
+	//	Returns:		None
+	//	Calls:			make_ring()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range, bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	WorkStealingDeque<DataType, Alloc>::WorkStealingDeque(size_t capacity,
+		const Alloc& alloc)
+		: m_top(0), m_bottom(0), m_slotAlloc(alloc), m_ringAlloc(alloc)
+	{
+		if (capacity == 0 || capacity > (~size_t(0) >> 2))
+			throw out_of_range("Could not create deque: Bad capacity");
+		size_t slots = 1;
+		while (slots < capacity)
+			slots <<= 1;
+		m_ring.store(make_ring(slots, nullptr), memory_order_relaxed);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			WorkStealingDeque<DataType>::~WorkStealingDeque()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destructor.  Frees the current ring and every ring
+	//						it replaced.  No thread may still be using the
+	//						deque.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	WorkStealingDeque<DataType, Alloc>::~WorkStealingDeque()
+	{
+		ring* r = m_ring.load(memory_order_relaxed);
+		while (r != nullptr)
+		{
+			ring* previous = r->previous;
+			allocator_traits<slot_allocator>::deallocate(m_slotAlloc,
+				r->slots, r->mask + 1);
+			allocator_traits<ring_allocator>::deallocate(m_ringAlloc, r, 1);
+			r = previous;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void WorkStealingDeque<DataType>::push_back
+	//						(const DataType& datum)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Stores datum in the slot at bottom, growing the ring
+	//						first if it is full, then publishes it with a
+	//						release fence and a relaxed store of bottom + 1.
+	//						Owner only.
+	//	Parameters:		const DataType& datum- the element to add.
+	//	Returns:		None
+	//	Calls:			grow()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc if the ring cannot grow.  The deque is
+	//						then unchanged.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	void WorkStealingDeque<DataType, Alloc>::push_back(const DataType& datum)
+	{
+		long long bottom = m_bottom.load(memory_order_relaxed);
+		long long top = m_top.load(memory_order_acquire);
+		ring* r = m_ring.load(memory_order_relaxed);
+		if (bottom - top > static_cast<long long>(r->mask))
+			r = grow(r, top, bottom);
+		r->slots[bottom & r->mask].store(datum, memory_order_relaxed);
+		atomic_thread_fence(memory_order_release);
+		m_bottom.store(bottom + 1, memory_order_relaxed);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool WorkStealingDeque<DataType>::try_pop_back
+	//						(DataType& out)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Claims the back slot by lowering bottom, then, after
+	//						a full fence, reads top.  If other elements are
+	//						left, no thief can reach the back one.  If it is
+	//						the last, the owner races the thieves for it
+	//						with a compare-and-swap on top.  Owner only.
+	//	Parameters:		DataType& out- receives the element.
+	//	Returns:		False if the deque was empty or a thief won the
+	//						last element.
+	//	Calls:			None
+	//	Called by:		pop_back()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool WorkStealingDeque<DataType, Alloc>::try_pop_back(DataType& out)
+	{
+		long long bottom = m_bottom.load(memory_order_relaxed) - 1;
+		ring* r = m_ring.load(memory_order_relaxed);
+		m_bottom.store(bottom, memory_order_relaxed);
+		atomic_thread_fence(memory_order_seq_cst);
+		long long top = m_top.load(memory_order_relaxed);
+		if (top > bottom)
+		{
+			m_bottom.store(bottom + 1, memory_order_relaxed);
+			return false;
+		}
+		out = r->slots[bottom & r->mask].load(memory_order_relaxed);
+		if (top < bottom)
+			return true;
+		bool won = m_top.compare_exchange_strong(top, top + 1,
+			memory_order_seq_cst, memory_order_relaxed);
+		m_bottom.store(bottom + 1, memory_order_relaxed);
+		return won;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType WorkStealingDeque<DataType>::pop_front()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Steals the front element, trying again each time
+	//						another thread takes it first.
+	//	Parameters:		None
+	//	Returns:		The element.
+	//	Calls:			try_pop_front()
+	//					empty()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error if the deque is empty.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	DataType WorkStealingDeque<DataType, Alloc>::pop_front()
+	{
+		DataType datum;
+		while (!try_pop_front(datum))
+			if (empty())
+				throw runtime_error("Could not remove front item: Empty list");
+		return datum;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool WorkStealingDeque<DataType>::try_pop_front
+	//						(DataType& out)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Reads top, then, after a full fence, bottom.  If an
+	//						element lies between them, reads it and claims it
+	//						by advancing top with a compare-and-swap.  Any
+	//						thread.
+	//	Parameters:		DataType& out- receives the element.
+	//	Returns:		False if the deque was empty or the compare-and-swap
+	//						lost to the owner or another thief.  out is then
+	//						unspecified.
+	//	Calls:			None
+	//	Called by:		pop_front()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	bool WorkStealingDeque<DataType, Alloc>::try_pop_front(DataType& out)
+	{
+		long long top = m_top.load(memory_order_acquire);
+		atomic_thread_fence(memory_order_seq_cst);
+		long long bottom = m_bottom.load(memory_order_acquire);
+		if (top >= bottom)
+			return false;
+		ring* r = m_ring.load(memory_order_acquire);
+		out = r->slots[top & r->mask].load(memory_order_relaxed);
+		return m_top.compare_exchange_strong(top, top + 1,
+			memory_order_seq_cst, memory_order_relaxed);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			ring* WorkStealingDeque<DataType>::grow(ring* old,
+	//						long long top, long long bottom)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Copies the elements from top up to bottom into a new
+	//						ring twice the size and publishes it.  old is
+	//						kept, chained from the new ring, for thieves
+	//						that are still reading it.  Owner only.
+	//	Parameters:		ring* old- the full ring.
+	//					long long top, long long bottom- the element range.
+	//	Returns:		The new ring.
+	//	Calls:			make_ring()
+	//	Called by:		push_back()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	typename WorkStealingDeque<DataType, Alloc>::ring*
+		WorkStealingDeque<DataType, Alloc>::grow(ring* old, long long top,
+		long long bottom)
+	{
+		ring* r = make_ring((old->mask + 1) * 2, old);
+		for (long long i = top; i < bottom; i++)
+			r->slots[i & r->mask].store(
+				old->slots[i & old->mask].load(memory_order_relaxed),
+				memory_order_relaxed);
+		m_ring.store(r, memory_order_release);
+		return r;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			ring* WorkStealingDeque<DataType>::make_ring
+	//						(size_t slots, ring* previous)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Allocates a ring of slots atomic slots.
+	//	Parameters:		size_t slots- the slot count, a power of 2.
+	//					ring* previous- the ring it replaces, or nullptr.
+	//	Returns:		The ring.
+	//	Calls:			None
+	//	Called by:		Constructor
+	//					grow()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc>
+	typename WorkStealingDeque<DataType, Alloc>::ring*
+		WorkStealingDeque<DataType, Alloc>::make_ring(size_t slots,
+		ring* previous)
+	{
+		ring* r = allocator_traits<ring_allocator>::allocate(m_ringAlloc, 1);
+		try
+		{
+			r->slots = allocator_traits<slot_allocator>::allocate(
+				m_slotAlloc, slots);
+		}
+		catch (...)
+		{
+			allocator_traits<ring_allocator>::deallocate(m_ringAlloc, r, 1);
+			throw;
+		}
+		for (size_t i = 0; i < slots; i++)
+			new (r->slots + i) atomic<DataType>();
+		r->mask = slots - 1;
+		r->previous = previous;
+		return r;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			WorkStealingPool::WorkStealingPool(unsigned threads)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Constructor.  Makes every worker's deque, then starts
+	//						the threads.  If some threads cannot be started,
+	//						the pool runs with those that were.
+	//	Parameters:		unsigned threads- the number of workers, or 0 for
+	//						thread::hardware_concurrency().
+	//	Returns:		None
+	//	Calls:			work()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			system_error if no thread could be started.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline WorkStealingPool::WorkStealingPool(unsigned threads)
+		: m_queued(0), m_pending(0), m_sleeping(0), m_stopping(false)
+	{
+		if (threads == 0)
+			threads = thread::hardware_concurrency();
+		if (threads == 0)
+			threads = 1;
+		for (unsigned i = 0; i < threads; i++)
+		{
+			m_workers.push_back(unique_ptr<worker>(new worker));
+			m_workers.back()->pool = this;
+		}
+		m_threads.reserve(threads);
+		try
+		{
+			for (unsigned i = 0; i < threads; i++)
+				m_threads.emplace_back(&WorkStealingPool::work, this,
+					m_workers[i].get());
+		}
+		catch (const system_error&)
+		{
+			if (m_threads.empty())
+				throw;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			WorkStealingPool::~WorkStealingPool()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destructor.  Lets every task finish, then wakes the
+	//						workers to stop and joins them.  An exception a
+	//						task threw that wait() did not collect is
+	//						dropped.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline WorkStealingPool::~WorkStealingPool()
+	{
+		{
+			unique_lock<mutex> lock(m_lock);
+			while (m_pending.load() > 0)
+				m_done.wait(lock);
+			m_stopping = true;
+			m_wake.notify_all();
+		}
+		for (thread& t : m_threads)
+			t.join();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void WorkStealingPool::submit(Task t)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Wraps t in a heap task and queues it: on the back of
+	//						the calling worker's deque from inside a task,
+	//						otherwise on the shared queue.  Wakes a sleeping
+	//						worker if there is one.  A worker counts itself
+	//						asleep before it checks m_queued, and the task is
+	//						counted here before m_sleeping is checked, so one
+	//						side always sees the other.
+	//	Parameters:		Task t- called as t() on some worker.
+	//	Returns:		None
+	//	Calls:			current()
+	//					WorkStealingDeque's push_back method
+	//					ConcurrentQueue's push method
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc.  The task is then not queued.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template<class Task>
+	void WorkStealingPool::submit(Task t)
+	{
+		task* wrapped = new task(std::move(t));
+		m_pending++;
+		m_queued++;
+		try
+		{
+			worker* self = current();
+			if (self != nullptr && self->pool == this)
+				self->deque.push_back(wrapped);
+			else
+				m_injected.push(wrapped);
+		}
+		catch (...)
+		{
+			m_queued--;
+			m_pending--;
+			delete wrapped;
+			throw;
+		}
+		if (m_sleeping.load() > 0)
+		{
+			lock_guard<mutex> lock(m_lock);
+			m_wake.notify_one();
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void WorkStealingPool::wait()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Blocks until no task is pending, then rethrows the
+	//						first exception any task threw since the last
+	//						wait(), if there was one.  A task must not call
+	//						it, since that task is itself pending.
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			The first exception a task threw.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline void WorkStealingPool::wait()
+	{
+		exception_ptr error;
+		{
+			unique_lock<mutex> lock(m_lock);
+			while (m_pending.load() > 0)
+				m_done.wait(lock);
+			swap(error, m_error);
+		}
+		if (error)
+			rethrow_exception(error);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			bool WorkStealingPool::take(worker* self, task*& t)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Looks for a task: the back of self's own deque, then
+	//						the shared queue, then the front of each other
+	//						worker's deque in turn, starting with the next
+	//						one.
+	//	Parameters:		worker* self- the calling worker.
+	//					task*& t- receives the task.
+	//	Returns:		True if a task was found.
+	//	Calls:			WorkStealingDeque's try_pop_back and try_pop_front
+	//						methods
+	//					ConcurrentQueue's try_pop method
+	//	Called by:		work()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline bool WorkStealingPool::take(worker* self, task*& t)
+	{
+		bool found = self->deque.try_pop_back(t) || m_injected.try_pop(t);
+		size_t count = m_workers.size(), start = 0;
+		while (start < count && m_workers[start].get() != self)
+			start++;
+		for (size_t i = 1; !found && i < count; i++)
+			found = m_workers[(start + i) % count]->deque.try_pop_front(t);
+		if (found)
+			m_queued--;
+		return found;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void WorkStealingPool::execute(task* t)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Runs t, keeping the first exception for wait(), and
+	//						frees it.  The last pending task wakes wait().
+	//	Parameters:		task* t- the task.
+	//	Returns:		None
+	//	Calls:			t
+	//	Called by:		work()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline void WorkStealingPool::execute(task* t)
+	{
+		try
+		{
+			(*t)();
+		}
+		catch (...)
+		{
+			lock_guard<mutex> lock(m_lock);
+			if (!m_error)
+				m_error = current_exception();
+		}
+		delete t;
+		if (--m_pending == 0)
+		{
+			lock_guard<mutex> lock(m_lock);
+			m_done.notify_all();
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void WorkStealingPool::work(worker* self)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	A worker thread's loop: runs tasks while it can find
+	//						them, yields while a queued task is out of its
+	//						reach, and otherwise sleeps until a task is
+	//						queued.  Returns once the pool is stopping and
+	//						nothing is queued.
+	//	Parameters:		worker* self- this thread's worker.
+	//	Returns:		None
+	//	Calls:			take(); execute()
+	//	Called by:		Constructor (as the thread function)
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	inline void WorkStealingPool::work(worker* self)
+	{
+		current() = self;
+		task* t;
+		for (;;)
+		{
+			if (take(self, t))
+			{
+				execute(t);
+				continue;
+			}
+			if (m_queued.load() > 0)
+			{
+				// Queued, but not yet visible or lost to a thief.
+				this_thread::yield();
+				continue;
+			}
+			m_sleeping++;
+			{
+				unique_lock<mutex> lock(m_lock);
+				while (m_queued.load() <= 0 && !m_stopping)
+					m_wake.wait(lock);
+			}
+			m_sleeping--;
+			if (m_stopping && m_queued.load() <= 0)
+				break;
+		}
+	}
+} // End DL_CDLL namespace.
+
+#endif
@@ -1,849 +1,2813 @@
-//----------------------------------------------------------------------------
-//	File:			CircDoubLinkList.h
-//
-//	Class:			List
-//
-//	Title:			Circular Doubly-Linked List
-//
-//	Description:	This file contains the class definitions for the
-//						CDLL Template Class.
-//
-//	Programmer:		David Landry
-//					Using starting code provided by Paul Bladek
-//
-//	Date:			5/19/2016
-//
-//	Version:		1.1
-//
-//	Environment:	Hardware:	PC with Intel Core i7
-//					Software:	Windows 10 64-bit edition
-//								Compiled using Microsoft Visual Studio 2013
-//									Community
-//
-//	Class List:
-//		Allows the use, pushing to, and popping from a circular doubly-linked
-//			list.
-//
-//		Properties:
-//			listelem head-	This is the node inserted to or popped from the 
-//							front.  It is a listelem struct consisting of the
-//							data and pointers to the next and previous data
-//							node.  Its previous node is tail.
-//			listelem tail-	This is the node inserted to or popped from the
-//							back.  It is a listelem struct consisting of the
-//							data and pointers to the next and previous data
-//							node.  Its next node is head.
-//			unsigned m_size-The number of data nodes in the list.
-//
-//		Classes and structs contained within:
-//			listelem-		Each is one data node, containing a DataType, a
-//							pointer to previous, and a pointer to next.
-//				Properties:
-//						DataType data- The data contained within a node in the
-//							list.
-//						listelem *next- A pointer to the next linked node in
-//							the list (or the 1st if the current node is the
-//							tail).
-//						listelem *prev- A pointer to the previous linked node
-//							in the list (or to the last if the current node is
-//							the first).
-//				Method:		
-//						listelem(DataType datum, listelem* p, listelem* n)-
-//							The constructor for the listelem struct.
-//			iterator-		The iterator class.  This is a wrapper around a
-//							pointer associated with this list class.
-//				Properties:
-//						listelem* ptr- A pointer to the listelem that the
-//							iterator points to.
-//				Methods:
-//						iterator(listelem* p = nullptr)- Default constructor
-//						iterator operator++()- Prefix incrementer.
-//						iterator operator--()- Prefix decrementer.
-//						iterator operator++(int)- Postfix incrementer.
-//						iterator operator--(int)- Prefix decrementer.
-//						listelem* operator->() const- Target operator.
-//							Accesses listelem's members using the iterator.
-//						DataType& operator*() const- Dereferencing operator.
-//							Accesses the reference of the DataType.
-//						operator listelem*() const- Dereferencing operator.
-//							Accesses the value of the listelem.
-//
-//		Methods:
-//			Inline:
-//				List<DataType>()
-//					Description:	The default constructor
-//					Parameters:		None
-//					Returns:		None
-//					Calls:			None
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				List<DataType>(size_t n_elements, DataType datum)
-//					Description:	Constructor taking in a quantity of
-//										n_element DataTypes.
-//					Parameters:		size_t n_elements- The number of elements
-//										to construct the object with.
-//									DataType datum- The data to fill the List
-//										with.
-//					Returns:		None
-//					Calls:			None
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				~List<DataType>()
-//					Description:	The destructor.
-//					Parameters:		None
-//					Returns:		None
-//					Calls:			release()
-//					Called by:		None
-//					Input:			None
-//					Output:			None
-//				virtual unsigned getSize() const
-//					Description:	Returns the number of data nodes in the
-//										List.
-//					Parameters:		None
-//					Returns:		m_size
-//					Calls:			None
-//					Called by:		operator[]
-//									operator[] const
-//					Input:			None
-//					Output:			None
-//				virtual iterator begin() const
-//					Description:	Returns an iterator that points to the
-//										List's head.
-//					Parameters:		None
-//					Returns:		head
-//					Calls:			None
-//					Called by:		Copy constructor
-//									operator=
-//									pop_front()
-//									operator[]
-//									operator<<
-//					Input:			None
-//					Output:			None
-//				virtual iterator end() const
-//					Description:	Returns an iterator that points to the
-//										List's tail.
-//					Parameters:		None
-//					Returns:		tail
-//					Calls:			None
-//					Called by:		Copy constructor
-//									operator=
-//									pop_back()
-//									operator[]
-//									operator<<
-//					Input:			None
-//					Output:			None
-//				virtual bool empty()const
-//					Description:	Tests whether the List is empty.
-//					Parameters:		None
-//					Returns:		True if either head or tail points to a
-//										nullptr.  Otherwise false.
-//					Calls:			None
-//					Called by:		push_front(); push_back();
-//									pop_front(); pop_back()
-//					Input:			None
-//					Output:			None
-//
-//			Non-inline:
-//				List<DataType>(const List& x)- Copy constructor.
-//				List<DataType>(iterator b, iterator e)- Constructor that uses
-//					iterators to construct a list.
-//				void push_front(DataType datum)- Adds a data node to the front 
-//					of the list, also adding 1 to the size of the list.
-//				DataType pop_front()- Removes a data node from the front of
-//					the list, reducing its size by 1, and returning the value
-//					stored in that data node.
-//				push_back(DataType datum)- Adds a data node to the back of the
-//					list, also adding 1 to the size of the list.
-//				DataType pop_back()- Removes a data node from the back of the
-//					list, reducing its size by 1, and returning the value
-//					stored in that data node.
-//				DataType& front() const- Returns the data value in the head
-//					data node.
-//				DataType& back() const- Returns the data value in the tail
-//					data node.
-//				void release()- Empties the list, resetting its size to 0,
-//					freeing the memory of each data node, and setting each
-//					pointer to nullptr.
-//				List<DataType>operator=- Sets the contents of one List to that 
-//					of another.
-//				DataType operator[](int index)- Accesses the data in the data
-//					node at the index within the brackets for editing.
-//				DataType operator[](int index) const- Accesses the data in the
-//					data node at the index within the brackets for read access
-//
-//	Functions:
-//		ostream& operator<<(ostream& sout, const List<DataType>& x)- Outputs 
-//			the list to the indicated output stream.
-//----------------------------------------------------------------------------
-#ifndef DL_CIRCULAR_DOUBLY_LINKED_LIST_H
-#define DL_CIRCULAR_DOUBLY_LINKED_LIST_H
-
-#include <iostream>
-#include <cassert>
-#include <exception>
-#include <cstdlib>
-#include <string>
-
-using namespace std;
-
-namespace DL_CDLL
-{
-	template<class DataType>
-	class List
-	{
-	public:
-		// forward declarations:
-		struct listelem;
-		class iterator;
-
-		// constructors
-		List<DataType>() : head(nullptr), tail(nullptr), m_size(0) {}
-		List<DataType>(size_t n_elements, DataType datum);
-		List<DataType>(const List& x);
-		List<DataType>(iterator b, iterator e);
-
-		// Destructor
-		virtual ~List<DataType>() { release(); }
-
-		// Public methods:
-		virtual unsigned getSize() const { return m_size; }
-		virtual iterator begin() const { return head; }
-		virtual iterator end() const { return tail; }
-		void push_front(DataType datum);
-		DataType pop_front();
-		void push_back(DataType datum);
-		DataType pop_back();
-		DataType& front() const;
-		DataType& back() const;
-		virtual bool empty()const 
-			{ return head == nullptr || tail == nullptr; }
-		void release();
-		List<DataType> operator=(const List<DataType> & rlist);
-		DataType& operator[](int index);
-		const DataType& operator[](int index) const;
-	private:
-		// Properties:
-		listelem *head;
-		listelem *tail;
-		unsigned m_size; // number of elements in the list
-	public:
-		// The struct for each node and the List-scoped iterator class are
-		//	configured here.
-		struct listelem // list cell
-		{
-			DataType data;
-			listelem *next;
-			listelem *prev;
-			// Struct constructor:
-			listelem(DataType datum, listelem* p, listelem* n)
-				: data(datum), prev(p), next(n) {}
-		};
-		// Iterator class is scoped within List class!
-		// Here's its setup:
-		class iterator
-		{
-		public:
-			iterator(listelem* p = nullptr) : ptr(p){}
-			// Prefix increment
-			iterator operator++()
-			{
-				if (ptr == nullptr)
-					throw runtime_error
-					("Could not increment the iterator: nullptr pointer");
-				ptr = ptr->next;
-				return *this;
-			}
-			// Prefix decrement
-			iterator operator--()
-			{
-				if (ptr == nullptr)
-					throw runtime_error
-					("Could not decrement the iterator: nullptr pointer");
-				ptr = ptr->prev;
-				return *this;
-			}
-			// Postfix increment
-			iterator operator++(int)
-			{
-				if (ptr == nullptr)
-					throw runtime_error
-					("Could not increment the iterator: nullptr pointer");
-				iterator temp = *this;
-				ptr = ptr->next;
-				return temp;
-			}
-			// Postfix decrement
-			iterator operator--(int)
-			{
-				if (ptr == nullptr)
-					throw runtime_error
-					("Could not decrement the iterator: nullptr pointer");
-				iterator temp = nullptr;
-				ptr = ptr->prev;
-				return temp;
-			}
-			listelem* operator->() const { return ptr; }
-			DataType& operator*() const
-			{ 
-				if (ptr == nullptr) 
-					throw runtime_error
-					("Could not retrieve data from an empty list.");
-				else return ptr->data; }
-			operator listelem*() const { return ptr; }
-		private:
-			listelem* ptr; //current listelem or nullptr
-		};	// End List::iterator class declarations.
-	}; // End List class declarations.
-
-	// Here is the declaration for the overloaded output operator used by the 
-	//	List class:
-	template <class DataType>
-	ostream& operator<<(ostream& sout, const List<DataType>& x);
-
-	// Definitions for the List class now follow.
-
-	//------------------------------------------------------------------------
-	//	Method:			List<DataType>::List(size_t n_elements,DataType datum)
-	//	Version			1.1
-	//	Date			5/19/2016
-	//	Description:	Constructor that fills the list with a quantity of
-	//						n_elements DataTypes.
-	//	Parameters:		size_t n_elements- the quantity of items to fill the
-	//						List with.
-	//					DataType datum- the data to fill the List with.
-	//	Returns:		None
-	//	Calls:			push_front()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Throws:			out_of_range
-	//	Changelog		4/15/2011	PB	completed version 0.7
-	//					4/29/2016	DL	completed version 0.8, adapting the 
-	//										code to the template class
-	//										List<DataType>.
-	//					5/13/2016	DL	completed version 1.0.
-	//					5/19/2016	DL	completed version 1.1, writing a
-	//										more specific exception throw
-	//										message.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	List<DataType>::List(size_t n_elements, DataType datum)
-		:m_size(0), head(nullptr), tail(nullptr)
-	{
-		if (n_elements <= 0)
-			throw out_of_range("Could not create List object: Empty list");
-		for (size_t i = 0; i < n_elements; ++i)
-		{
-			push_front(datum);
-		}
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			List<DataType>::List(const List& source)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	Copy constructor
-	//	Parameters:		const List& source- the List to copy from.
-	//	Returns:		None
-	//	Calls:			begin()
-	///					end()
-	//					push_back()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		4/15/2011	PB	completed version 0.4
-	//					4/29/2016	DL	completed version 0.5, adapting the 
-	//										code to the List<DataType>
-	//										template class.
-	//					5/13/2016	DL	completed version 1.0, fixing memory-
-	//										related bugs.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	List<DataType>::List(const List& source)
-		: m_size(0), head(nullptr), tail(nullptr)
-	{
-		m_size = source.m_size;
-		//listelem* toCopy = new listelem[m_size];
-		List<DataType>::iterator r_it = source.begin();
-		while (r_it != source.end())
-			push_back(*r_it++);
-		push_back(*r_it);
-		m_size = source.m_size;
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			List<DataType>::List(iterator b, iterator e)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	constructor using iterators, copies from b to one 
-	//						before e
-	//	Parameters:		iterator b- the begin iterator.
-	//					iterator e- the end iterator.
-	//	Returns:		None
-	//	Calls:			push_back()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		4/15/2011	PB	completed version 0.7
-	//					4/29/2016	DL	completed version 0.8, adapting it to 
-	//										the template class List<DataType>.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	List<DataType>::List(iterator b, iterator e)
-		:m_size(0), head(nullptr), tail(nullptr)
-	{
-		while (b != e)
-			push_back(*b++);
-		push_back(*b);
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			void List<DataType>::release()
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	empties the list
-	//	Parameters:		None
-	//	Returns:		None
-	//	Calls:			pop_front()
-	//	Called by:		~List() (the destructor)
-	//					operator=
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		4/15/2011	PB	completed version 0.8
-	//					4/29/2016	DL	completed version 0.9, adapting it to 
-	//										the template class List<DataType>.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	void List<DataType>::release()
-	{
-		while (head != tail)
-			List::pop_front();
-		if (head == tail && tail != nullptr)
-			List::pop_front();
-		head = tail = nullptr;
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			void List<DataType>::push_front(DataType datum)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	insert element at front of list
-	//	Parameters:		DataType datum- the data to insert
-	//	Returns:		None
-	//	Calls:			listelem struct constructor
-	//					empty()
-	//	Called by:		Fill constructor
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		4/15/2011	PB	completed version 0.8
-	//					4/29/2016	DL	copied from PB's list push_front
-	//										method and changed it to 
-	//										List<DataType> push_front.
-	//					5/4/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template<class DataType>
-	void List<DataType>::push_front(DataType datum)
-	{
-		listelem* temp = new listelem(datum, tail, head);
-		m_size++;
-		if (!empty())
-		{ // was a nonempty list
-			head->prev = temp;
-			head = temp;
-			//head->prev = tail;
-			tail->next = head;
-		}
-		else
-		{
-			temp->prev = temp;
-			temp->next = temp;
-			head = tail = temp;
-		}
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			void List<DataType>::push_back(DataType datum)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	insert element at end of list
-	//	Parameters:		DataType datum- the item to insert
-	//	Returns:		None
-	//	Calls:			listelem struct constructor
-	//					empty()
-	//	Called by:		Copy Constructor
-	//					Iterator constructor
-	//					operator=
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		5/2/2016	DL	completed version 0.5, but seems to 
-	//										have gotten the pointers in the 
-	//										incorrect order.
-	//					5/4/2016	DL	completed version 0.9.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template<class DataType>
-	void List<DataType>::push_back(DataType datum)
-	{
-		listelem* temp = new listelem(datum, tail, head);
-		m_size++;
-		if (!empty())
-		{ // was a nonempty list
-			tail->next = temp;
-			tail = temp;
-			//tail->next = head;
-			head->prev = tail;
-		}
-		else
-		{
-			head = tail = temp;
-			head->prev = tail;
-			head->next = tail;
-			tail->prev = head;
-			tail->next = tail;
-		}
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			List<DataType> List<DataType>::operator=
-	//						(const List<DataType>& rlist)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	returns a copy of rlist
-	//	Parameters:		const List<DataType>& rlist- the List to copy from.
-	//	Returns:		A List<DataType> that is a copy of rlist.
-	//	Calls:			begin()
-	//					end()
-	//					release()
-	//					push_back()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		4/15/2011	PB completed version 0.5
-	//					4/29/2016	DL	completed version 0.6, adapting the 
-	//										code to fit the mold of the 
-	//										template class List<DataType>.
-	//					5/4/2016	DL	completed version 0.8, correcting the
-	//										order of list elements copied to
-	//										the new list.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	List<DataType> List<DataType>::operator=(const List<DataType>& rlist)
-	{
-		if (&rlist != this)
-		{
-			List<DataType>::iterator r_it = rlist.begin();
-			release();
-			while (r_it != rlist.end())
-				push_back(*r_it++);
-			push_back(*r_it);
-		}
-		return *this;
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			DataType List<DataType>::pop_front()
-	//	Version			1.1
-	//	Date			5/19/2016
-	//	Description:	removes front element and returns the data from that 
-	//						element
-	//	Parameters:		None
-	//	Returns:		A DataType equal to the item being popped.
-	//	Calls:			begin()
-	//					empty()
-	//	Called by:		release()
-	//	Input:			None
-	//	Output:			None
-	//	Throws:			runtime_error
-	//	Changelog		4/15/2011	PB	completed version 0.7
-	//					4/30/2016	DL	completed version 0.8, adapting the 
-	//										code to the template class 
-	//										List<DataType>.
-	//					5/13/2016	DL	completed version 1.0, fixing memory-
-	//										related bugs.
-	//					5/19/2016	DL	completed version 1.1, adding clearer
-	//										exception throw message.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	DataType List<DataType>::pop_front()
-	{
-		if (head == nullptr)
-			throw runtime_error("Could not remove front item: Empty list");
-		m_size--;
-		DataType data = head->data;
-		iterator temp = begin();
-		temp++;
-		if (m_size >= 0)
-			delete head;
-		if (m_size == 0)
-			head = nullptr;
-		if (!empty())
-		{
-			head = temp;
-			head->prev = tail;
-			tail->next = head;
-		}
-		else
-			head = tail = nullptr; // empty at both ends
-		return data;
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			DataType List<DataType>::pop_back()
-	//	Version			1.1
-	//	Date			5/19/2016
-	//	Description:	removes back element and returns the data from that 
-	//						element
-	//	Parameters:		None
-	//	Returns:		A DataType that equals the item being popped.
-	//	Calls:			iterator::end()
-	//					empty()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Throws:			runtime_error
-	//	Changelog		5/5/2016	DL	completed version 0.4
-	//					5/5/2016	DL	completed version 0.8, fixing the
-	//										iterator.
-	//					5/13/2016	DL	completed version 1.0, fixing memory-
-	//										related bugs.
-	//					5/19/2016	DL	completed version 1.1, writing a
-	//										more specific exception throw
-	//										message.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	DataType List<DataType>::pop_back()
-	{
-		if (tail == nullptr)
-			throw runtime_error
-			("Could not remove item from the back: Empty list");
-		m_size--;
-		DataType data = tail->data;
-		iterator temp = end();
-		temp--;
-		if (m_size >= 0)
-			delete tail;
-		if (m_size == 0)
-			tail = nullptr;
-		if (!empty())
-		{
-			tail = temp;
-			tail->next = head;
-			head->prev = tail;
-		}
-		else
-			head = tail = nullptr; // empty at both ends
-		return data;
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			DataType& front() const
-	//	Version:		1.1
-	//	Date:			5/19/2016
-	//	Description:	Returns the data value within the head.
-	//	Parameters:		None
-	//	Returns:		head->data
-	//	Calls:			None
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Throws:			runtime_error
-	//	Changelog:		5/13/2016	DL	completed version 1.0
-	//					5/19/2016	DL	completed version 1.1, correcting a
-	//										program-breaking bug when
-	//										attempting to access the head of
-	//										an empty list.
-	//------------------------------------------------------------------------
-	template<class DataType>
-	DataType& List<DataType>::front() const 
-	{ 
-		if (empty())
-			throw runtime_error
-			("Could not access the front value of an empty list.");
-		else
-			return head->data;
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			DataType& back() const
-	//	Version:		1.1
-	//	Date:			5/19/2016
-	//	Description:	Returns the data value within the tail.
-	//	Parameters:		None
-	//	Returns:		tail->data
-	//	Calls:			None
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Throws:			runtime_error
-	//	Changelog:		5/13/2016	DL	completed version 1.0
-	//					5/19/2016	DL	completed version 1.1, correcting a
-	//										program-breaking bug when
-	//										attempting to access the tail of
-	//										an empty list.
-	//------------------------------------------------------------------------
-	template<class DataType>
-	DataType& List<DataType>::back() const
-	{ 
-		if (empty()) 
-			throw runtime_error
-			("Could not access the back value of an empty list."); 
-		else 
-			return tail->data; 
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			DataType& List<DataType>::operator[](int index)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	[] operator -- Modifiable l-value
-	//	Parameters:		int index- An integer used to get the index of the
-	//						desired item.
-	//	Returns:		DataType&, a reference to the data contained at the
-	//						index.
-	//	Calls:			getSize()
-	//					end()
-	//					begin()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		4/15/1011	PB	completed version 0.6
-	//					4/30/2016	DL	completed version 0.7, adapting the 
-	//										code to the template class 
-	//										List<DataType>.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	DataType& List<DataType>::operator[](int index)
-	{
-		iterator it;
-		int testSize = getSize();
-		int midpoint = getSize() / 2;
-		List<DataType>* midPointer = this + midpoint;
-		if (index < 0)
-		{
-			if (index < -(static_cast<int>(getSize())))
-				throw out_of_range("index out-of-range");
-			index = getSize() + index;
-		}
-		else
-		{
-			if (index >= static_cast<int>(getSize()))
-				throw out_of_range("index out-of-range");
-		}
-		if (index >= midpoint)
-		{
-			it = end();
-			for (int i = getSize() - 1; i > index; i--)
-				it--;
-		}
-		else
-		{
-			it = begin();
-			for (int i = 0; i < index; i++)
-				it++;
-		}
-		return *it;
-	}
-
-	//------------------------------------------------------------------------
-	//	Method:			const DataType& List<DataType>::operator[](int index)
-	//						const
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	[] operator -- Non-modifiable r-value
-	//	Parameters:		int index- An integer used to get the index of the
-	//						desired item.
-	//	Returns:		A const DataType&; a reference to the item.
-	//	Calls:			getSize()
-	//					end()
-	//					begin()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			None
-	//	Changelog		4/15/2011	PB	completed version 0.6
-	//					4/30/2016	DL	completed version 0.7, adapting the 
-	//										code to the template class 
-	//										List<DataType>.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	const DataType& List<DataType>::operator[](int index)const
-	{
-		iterator it;
-		int midpoint = getSize() / 2;
-		List<DataType>* midPointer = this + midpoint;
-		if (index < 0)
-		{
-			if (index < -(static_cast<int>(getSize())))
-				throw out_of_range("index out-of-range");
-			index = getSize() - index;
-		}
-		else
-		{
-			if (index >= static_cast<int>(getSize()))
-				throw out_of_range("index out-of-range");
-		}
-		if (index > midpoint)
-		{
-			it = end();
-			for (int i = getSize() - 1; i > index; i--)
-				it--;
-		}
-		else
-		{
-			it = begin();
-			for (int i = 0; i < index; i++)
-				it++;
-		}
-		return *it;
-	}
-
-	//------------------------------------------------------------------------
-	//	Function:		ostream& operator<<
-	//						(ostream& sout, const List<DataType>& x)
-	//	Version			1.0
-	//	Date			5/13/2016
-	//	Description:	prints out a list
-	//	Parameters:		ostream& sout- A reference to the output stream.
-	//					const List<DataType>& x- A reference to the item to be
-	//						printed.
-	//	Returns:		The ostream&
-	//	Calls:			begin()
-	//					end()
-	//	Called by:		None
-	//	Input:			None
-	//	Output:			The data contents of the List.
-	//	Changelog		4/15/2011	PB	completed version 0.8
-	//					4/29/2016	DL	completed version 0.9, adapting it to
-	//										the template class List<DataType>.
-	//					5/13/2016	DL	completed version 1.0.
-	//------------------------------------------------------------------------
-	template <class DataType>
-	ostream& operator<<(ostream& sout, const List<DataType>& x)
-	{
-		List<DataType>::iterator p = x.begin(); // gets x.h
-		List<DataType>::iterator q = x.begin();	// gets x.h too.
-		sout << "(";
-		if (p != nullptr)
-		{
-			do
-			{
-				sout << *q;
-				if (q != x.end())
-					sout << ",";
-				++q; // advances iterator using next
-			} while (p != q);
-		}
-		sout << ")\n";
-		return sout;
-	}
-
-
-} // End DL_CDLL namespace.
-
+//----------------------------------------------------------------------------
+//	File:			CircDoubLinkList.h
+//
+//	Class:			List
+//					ListElem, ListIterator, ListDispatch
+//					CheckedIterators, UncheckedIterators
+//					ListRangeIterator, ListRange
+//					RoundRobinCursor
+//
+//	Title:			Circular Doubly-Linked List
+//
+//	Description:	This file contains the class definitions for the
+//						CDLL Template Class.
+//
+//	Programmer:		David Landry
+//					Using starting code provided by Paul Bladek
+//
+//	Date:			10/17/2026
+//
+//	Version:		1.4
+//
+//	Environment:	Hardware:	PC with Intel Core i7
+//					Software:	Windows 10 64-bit edition
+//								Compiled using Microsoft Visual Studio 2013
+//									Community
+//
+//	Class List:
+//		Allows the use, pushing to, and popping from a circular doubly-linked
+//			list.
+//
+//		Properties:
+//			listelem head-	This is the node inserted to or popped from the 
+//							front.  It is a listelem struct consisting of the
+//							data and pointers to the next and previous data
+//							node.  Its previous node is tail.
+//			listelem tail-	This is the node inserted to or popped from the
+//							back.  It is a listelem struct consisting of the
+//							data and pointers to the next and previous data
+//							node.  Its next node is head.
+//			unsigned m_size-The number of data nodes in the list.
+//			node_allocator m_alloc-	The allocator, rebound from Alloc to
+//							listelem, that every node is allocated from.
+//							Alloc defaults to allocator<DataType>; a
+//							PoolAllocator (CDLL_PoolAllocator.h) recycles
+//							nodes instead of calling new and delete.
+//			index_cache m_indexing- How operator[] finds a node:
+//							PlainIndexing, the default, walks from the
+//							nearer end; CachedIndexing (see
+//							DL_CDLL_INDEX_CACHE) keeps a finger and a skip
+//							index so lookups take O(sqrt(n)).
+//
+//		Types exported:
+//			listelem-		A typedef for ListElem<DataType>, one data node,
+//							containing a pointer to next, a pointer to
+//							previous, and a DataType.  next comes first so
+//							that release() can hand a chain of nodes to a
+//							NodePool as a free list.
+//			iterator-		A typedef for ListIterator<DataType>, a wrapper
+//							around a listelem pointer.  Both are declared
+//							outside List so that they do not depend on Alloc
+//							or Dispatch, and so that ListDispatch can name
+//							them.
+//							ListIterator takes a Checking policy,
+//							CheckedIterators or UncheckedIterators, that
+//							defaults to DefaultIteratorChecking (see
+//							DL_CDLL_CHECKED_ITERATORS).  Unchecked, every
+//							operation is noexcept.  front() and back() take
+//							their own policy, DefaultAccessChecking (see
+//							DL_CDLL_CHECKED_ACCESS).  It provides the
+//							bidirectional iterator typedefs
+//							(iterator_category, value_type, difference_type,
+//							pointer and reference).
+//				Methods:
+//						iterator(listelem* p = nullptr)- Default constructor
+//						iterator& operator++()- Prefix incrementer.
+//						iterator& operator--()- Prefix decrementer.
+//						iterator operator++(int)- Postfix incrementer.
+//						iterator operator--(int)- Postfix decrementer.
+//						DataType* operator->() const- Member access.
+//							Accesses the members of the data.
+//						DataType& operator*() const- Dereferencing operator.
+//							Accesses the reference of the DataType.
+//						operator listelem*() const- Conversion operator.
+//							Accesses the listelem itself.
+//							Checked, the increment, decrement and access
+//							operators throw runtime_error on a nullptr
+//							iterator.
+//			range_iterator, const_range_iterator-	Typedefs for
+//							ListRangeIterator<DataType, DataType> and
+//							ListRangeIterator<DataType, const DataType>.
+//							These bidirectional iterators run from the head
+//							to one past the tail.  They count the nodes left
+//							instead of comparing with the head, and are
+//							never checked.
+//
+//		Template parameters:
+//			DataType-		The type stored in each node.
+//			Alloc-			The allocator, see m_alloc.
+//			Dispatch-		DynamicDispatch (the default) or StaticDispatch.
+//							List derives from ListDispatch<DataType,
+//							Dispatch>.  Under DynamicDispatch the destructor,
+//							getSize(), begin(), end() and empty() override
+//							that base's virtual functions.  Under
+//							StaticDispatch the base is empty, the List has no
+//							vtable pointer, and those calls can be inlined.
+//
+//		Methods:
+//			Inline:
+//				List<DataType>()
+//					Description:	The default constructor
+//					Parameters:		None
+//					Returns:		None
+//					Calls:			None
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				List<DataType>(const Alloc& alloc)
+//					Description:	Constructor taking in the allocator to
+//										allocate nodes with.
+//					Parameters:		const Alloc& alloc- The allocator.
+//					Returns:		None
+//					Calls:			None
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				List<DataType>(size_t n_elements, DataType datum,
+//					const Alloc& alloc)
+//					Description:	Constructor taking in a quantity of
+//										n_element DataTypes.
+//					Parameters:		size_t n_elements- The number of elements
+//										to construct the object with.
+//									DataType datum- The data to fill the List
+//										with.
+//									const Alloc& alloc- The allocator.
+//					Returns:		None
+//					Calls:			None
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				~List<DataType>()
+//					Description:	The destructor.
+//					Parameters:		None
+//					Returns:		None
+//					Calls:			release()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				unsigned getSize() const
+//					Description:	Returns the number of data nodes in the
+//										List.
+//					Parameters:		None
+//					Returns:		m_size
+//					Calls:			None
+//					Called by:		operator[]
+//									operator[] const
+//					Input:			None
+//					Output:			None
+//				iterator begin() const
+//					Description:	Returns an iterator that points to the
+//										List's head.
+//					Parameters:		None
+//					Returns:		head
+//					Calls:			None
+//					Called by:		Copy constructor
+//									operator=
+//									pop_front()
+//									operator[]
+//									operator<<
+//					Input:			None
+//					Output:			None
+//				iterator end() const
+//					Description:	Returns an iterator that points to the
+//										List's tail.
+//					Parameters:		None
+//					Returns:		tail
+//					Calls:			None
+//					Called by:		Copy constructor
+//									operator=
+//									pop_back()
+//									operator[]
+//									operator<<
+//					Input:			None
+//					Output:			None
+//				const_range_iterator cbegin() const
+//					Description:	Returns a past-the-end style iterator to
+//										the List's head.
+//					Parameters:		None
+//					Returns:		A const_range_iterator at head.
+//					Calls:			None
+//					Called by:		range() const
+//									operator<<
+//					Input:			None
+//					Output:			None
+//				const_range_iterator cend() const
+//					Description:	Returns an iterator one past the List's
+//										tail.  One -- from it reaches the
+//										tail.
+//					Parameters:		None
+//					Returns:		A const_range_iterator with no nodes left.
+//					Calls:			None
+//					Called by:		range() const
+//									operator<<
+//					Input:			None
+//					Output:			None
+//				ListRange<range_iterator> range()
+//				ListRange<const_range_iterator> range() const
+//					Description:	Returns the whole List as a begin/end
+//										pair, for range-for and
+//										<algorithm>.
+//					Parameters:		None
+//					Returns:		The pair of iterators.
+//					Calls:			cbegin(); cend()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				bool empty()const
+//					Description:	Tests whether the List is empty.
+//					Parameters:		None
+//					Returns:		True if either head or tail points to a
+//										nullptr.  Otherwise false.
+//					Calls:			None
+//					Called by:		push_front(); push_back();
+//									pop_front(); pop_back()
+//					Input:			None
+//					Output:			None
+//				void push_front(DataType&& datum)
+//					Description:	Adds a data node to the front of the list,
+//										moving datum into it.
+//					Parameters:		DataType&& datum- The data to move in.
+//					Returns:		None
+//					Calls:			create_node(); link_front()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				void push_back(DataType&& datum)
+//					Description:	Adds a data node to the back of the list,
+//										moving datum into it.
+//					Parameters:		DataType&& datum- The data to move in.
+//					Returns:		None
+//					Calls:			create_node(); link_back()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				DataType& emplace_front(Args&&... args)
+//					Description:	Adds a data node to the front of the list,
+//										constructing its data in place.
+//					Parameters:		Args&&... args- The arguments for
+//										DataType's constructor.
+//					Returns:		A reference to the new data.
+//					Calls:			create_node(); link_front()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				DataType& emplace_back(Args&&... args)
+//					Description:	Adds a data node to the back of the list,
+//										constructing its data in place.
+//					Parameters:		Args&&... args- The arguments for
+//										DataType's constructor.
+//					Returns:		A reference to the new data.
+//					Calls:			create_node(); link_back()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				bool try_pop_front(DataType& out)
+//				bool try_pop_back(DataType& out)
+//					Description:	Moves the front (or back) element into
+//										out and removes its node, as
+//										pop_front() (or pop_back()) does,
+//										but an empty list is not an error:
+//										it costs one branch, not a throw.
+//										noexcept when DataType's move
+//										constructor and move assignment
+//										are.
+//					Parameters:		DataType& out- where the element is
+//										moved.
+//					Returns:		true if an element was removed, false if
+//										the list was empty.
+//					Calls:			empty(); pop_front(); pop_back()
+//					Called by:		Queue's try_pop method
+//					Input:			None
+//					Output:			None
+//				void concat(List& x)
+//					Description:	Moves all of x's nodes onto the back of
+//										the list in O(1), leaving x empty.
+//					Parameters:		List& x- The list to append.
+//					Returns:		None
+//					Calls:			splice()
+//					Called by:		drain_into()
+//					Input:			None
+//					Output:			None
+//				void drain_into(List& x)
+//					Description:	Moves all of this list's nodes onto the
+//										back of x in O(1), leaving this list
+//										empty.
+//					Parameters:		List& x- The list to append to.
+//					Returns:		None
+//					Calls:			concat()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				iterator insert(iterator pos, const DataType& datum)
+//				iterator insert(iterator pos, DataType&& datum)
+//				iterator emplace(iterator pos, Args&&... args)
+//					Description:	Adds a data node ahead of pos, or at the
+//										back for iterator(), in O(1).
+//					Parameters:		iterator pos- the node to insert ahead
+//										of.
+//									The data to copy or move in, or the
+//										arguments for DataType's
+//										constructor.
+//					Returns:		An iterator to the new node.
+//					Calls:			create_node(); link_range()
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//				Alloc get_allocator() const
+//					Description:	Returns a copy of the List's allocator.
+//					Parameters:		None
+//					Returns:		m_alloc, converted back to Alloc.
+//					Calls:			None
+//					Called by:		None
+//					Input:			None
+//					Output:			None
+//
+//			Non-inline:
+//				List<DataType>(const List& x)- Copy constructor.
+//				List<DataType>(List&& x)- Move constructor.  x is left empty.
+//				List<DataType>(iterator b, iterator e, const Alloc& alloc)-
+//					Constructor that uses iterators to construct a list.
+//				void push_front(const DataType& datum)- Adds a data node to the
+//					front of the list, also adding 1 to the size of the list.
+//				DataType pop_front()- Removes a data node from the front of
+//					the list, reducing its size by 1, and returning the value
+//					stored in that data node, moved out.
+//				push_back(const DataType& datum)- Adds a data node to the back
+//					of the list, also adding 1 to the size of the list.
+//				DataType pop_back()- Removes a data node from the back of the
+//					list, reducing its size by 1, and returning the value
+//					stored in that data node, moved out.
+//				DataType& front() const- Returns the data value in the head
+//					data node.
+//				DataType& back() const- Returns the data value in the tail
+//					data node.
+//				void release()- Empties the list in a single pass, resetting
+//					its size to 0, freeing the memory of each data node, and
+//					setting each pointer to nullptr.
+//				List<DataType>& operator=- Sets the contents of one List to
+//					that of another, reusing the nodes it already has.
+//				List<DataType>& operator=(List&& rlist)- Move assignment.
+//					Takes over rlist's nodes, leaving rlist empty.
+//				DataType operator[](int index)- Accesses the data in the data
+//					node at the index within the brackets for editing.
+//				DataType operator[](int index) const- Accesses the data in the
+//					data node at the index within the brackets for read access
+//				void splice(iterator pos, List& x)- Moves all of x's nodes in
+//					ahead of pos (or at the back for iterator()) in O(1).
+//				void splice(iterator pos, List& x, iterator it)- Moves one
+//					node of x in ahead of pos in O(1).
+//				void splice(iterator pos, List& x, iterator first,
+//					iterator last)- Moves x's nodes from first through last
+//					in ahead of pos.
+//				List<DataType> split_at(iterator pos)- Moves the nodes from
+//					pos through the tail into a new List.
+//				void push_range(InputIt first, InputIt last)- Adds copies of
+//					the items from first up to last at the back, linking them
+//					in as one chain.
+//				void push_n(size_t n, const DataType& datum)- Adds n copies of
+//					datum at the back, linking them in as one chain.
+//				OutputIt pop_n(OutputIt out, size_t n)- Removes up to n items
+//					from the front as one chain and moves them out through out.
+//				iterator erase(iterator pos)- Removes the node at pos in O(1)
+//					and returns the node after it.
+//				void rotate(int k)- Moves the first k elements to the back
+//					(or, for a negative k, the last -k to the front) by moving
+//					head and tail along the circle.  Nothing is allocated.
+//				iterator advance(iterator pos, int k) const- Returns the node
+//					k steps after pos around the circle (before it, for a
+//					negative k), walking whichever way is shorter.  Throws
+//					runtime_error if the list is empty.
+//				void sort(), void sort(Compare comp)- Stable merge sort that
+//					relinks the nodes without allocating.
+//				void merge(List& x), void merge(List& x, Compare comp)-
+//					Merges sorted x into this sorted list, leaving x empty.
+//				listelem* create_node(Args&&... args)- Allocates a node and
+//					constructs its data from args.  (private)
+//				void destroy_node(listelem* node)- Destroys and frees a node.
+//					(private)
+//				void destroy_chain(listelem* node)- Destroys and frees an
+//					unlinked, nullptr-terminated chain of nodes.  (private)
+//				void link_copies(const listelem* source, unsigned count)-
+//					Copies count nodes starting at source onto the back as
+//					one chain.  (private)
+//				void reserve_nodes(A& alloc, size_t n, ...)- Calls
+//					alloc.reserve(n) if the allocator has one.  (private)
+//				bool deallocate_nodes(A& alloc, listelem* first,
+//					listelem* last, size_t n, ...)- Calls
+//					alloc.deallocate_chain() if the allocator has one.
+//					(private)
+//				void link_front(listelem* node)- Links a new node in at the
+//					front.  (private)
+//				void link_back(listelem* node)- Links a new node in at the
+//					back.  (private)
+//				void link_range(listelem* pos, listelem* first,
+//					listelem* last, unsigned count)- Links a chain of nodes in
+//					ahead of pos.  (private)
+//				void unlink_range(listelem* first, listelem* last,
+//					unsigned count)- Unlinks a run of nodes as a chain.
+//					(private)
+//				listelem* node_at(int index) const- Finds the node at index
+//					for operator[].  (private)
+//				void invalidate_index() const- Drops the operator[] caches.
+//					(private)
+//				void merge_chains(listelem*& a, listelem* b, Compare& comp)-
+//					Merges two sorted nullptr-terminated chains into a.
+//					(private)
+//				listelem* join_chains(listelem* a, listelem* b)- Appends
+//					chain b to chain a.  (private)
+//				void adopt_chain(listelem* first)- Makes a nullptr-terminated
+//					chain of m_size nodes the list, restoring prev and the
+//					circle.  (private)
+//
+//	Class RoundRobinCursor:
+//		A position in a List that cycles through its elements without
+//			reordering them, for round-robin scheduling.  The cursor starts
+//			at the head and wraps from the tail back to the head.  Erase
+//			the cursor's own element through erase(), not through the
+//			List, or the cursor is left dangling.
+//
+//		Properties:
+//			List* m_list-	The list being cycled through.
+//			iterator m_pos-	The current element, or iterator() to start
+//							over at the head.
+//
+//		Methods:
+//			explicit RoundRobinCursor(List& list)- Constructor.
+//			DataType& current()- The current element.
+//			DataType& next()- The current element; the cursor then moves
+//				on to the one after it.
+//			void advance(int k)- Moves the cursor k elements on (or back,
+//				for a negative k) in O(min(k, n - k)).
+//			iterator position()- The current element's node.
+//			void erase()- Removes the current element from the list and
+//				moves on to the one after it.
+//			void reset()- Starts over at the head.
+//			Each of current(), next(), advance(), position() and erase()
+//				throws runtime_error if the list is empty.
+//
+//	Functions:
+//		ostream& operator<<(ostream& sout, const List<DataType>& x)- Outputs 
+//			the list to the indicated output stream.
+//----------------------------------------------------------------------------
+#ifndef DL_CIRCULAR_DOUBLY_LINKED_LIST_H
+#define DL_CIRCULAR_DOUBLY_LINKED_LIST_H
+
+#include <iostream>
+#include <cassert>
+#include <exception>
+#include <cstdlib>
+#include <string>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <cmath>
+#include <type_traits>
+#include <iterator>
+#include <cstddef>
+
+using namespace std;
+
+namespace DL_CDLL
+{
+	// Dispatch policies for List and Queue.  DynamicDispatch (the default)
+	//	keeps the virtual destructor, getSize(), begin(), end() and empty()
+	//	that let a List be used through a ListDispatch pointer.
+	//	StaticDispatch drops the vtable so those calls can be inlined on
+	//	hot paths; it cannot be deleted through a base pointer.
+	struct DynamicDispatch {};
+	struct StaticDispatch {};
+
+	// The node type shared by every List<DataType, ...>.
+	template<class DataType>
+	struct ListElem // list cell
+	{
+		ListElem *next; // must stay first, see List::release()
+		ListElem *prev;
+		DataType data;
+		// Struct constructor.  The data is constructed in place from args.
+		template<class... Args>
+		ListElem(ListElem* p, ListElem* n, Args&&... args)
+			: next(n), prev(p), data(std::forward<Args>(args)...) {}
+	};
+
+	// Checking policies.  CheckedIterators throws runtime_error when a
+	//	nullptr iterator is moved or dereferenced, or front() or back() is
+	//	called on an empty List; UncheckedIterators does no test at all and
+	//	every such operation is noexcept.
+	struct CheckedIterators
+	{
+		static void check(const void* p, const char* message)
+		{
+			if (p == nullptr)
+				throw runtime_error(message);
+		}
+	};
+	struct UncheckedIterators
+	{
+		static void check(const void*, const char*) noexcept {}
+	};
+
+	// The policy List's iterator uses.  Defaults to checked, or unchecked
+	//	when NDEBUG is defined; define DL_CDLL_CHECKED_ITERATORS as 1 or 0
+	//	to choose either way.
+#ifndef DL_CDLL_CHECKED_ITERATORS
+#ifdef NDEBUG
+#define DL_CDLL_CHECKED_ITERATORS 0
+#else
+#define DL_CDLL_CHECKED_ITERATORS 1
+#endif
+#endif
+	typedef conditional<DL_CDLL_CHECKED_ITERATORS != 0, CheckedIterators,
+		UncheckedIterators>::type DefaultIteratorChecking;
+
+	// The policy List's front() and back() use.  Defaults to checked even
+	//	when NDEBUG is defined, since an empty list is an ordinary state, not
+	//	a bug; define DL_CDLL_CHECKED_ACCESS as 0 to make both unchecked and
+	//	noexcept, for code that tests empty() or uses try_pop_front() first.
+#ifndef DL_CDLL_CHECKED_ACCESS
+#define DL_CDLL_CHECKED_ACCESS 1
+#endif
+	typedef conditional<DL_CDLL_CHECKED_ACCESS != 0, CheckedIterators,
+		UncheckedIterators>::type DefaultAccessChecking;
+
+	// operator[] lookup policies.  PlainIndexing keeps no state and walks
+	//	from the nearer end of the list.  CachedIndexing also remembers the
+	//	node found by the last lookup (the finger) and, once a lookup lands
+	//	far from every node it knows, every sqrt(n)-th node (the skip
+	//	index), so sequential access is O(1) and random access O(sqrt(n)),
+	//	at the price of some bookkeeping on every push and pop at the front.
+	//	Its caches are written by const lookups, so a const List using it
+	//	must not be indexed from several threads at once.  List uses
+	//	PlainIndexing unless DL_CDLL_INDEX_CACHE is defined as 1.
+#ifndef DL_CDLL_INDEX_CACHE
+#define DL_CDLL_INDEX_CACHE 0
+#endif
+	template<class Node>
+	struct PlainIndexing
+	{
+		void pushed_front() {}
+		void popping_front(const Node*) {}
+		void popping_back(const Node*, unsigned) {}
+		void invalidate() const {}
+		// The node at index, which must be in [0, size).
+		Node* find(Node* head, Node* tail, int size, int index) const
+		{
+			Node* node = head;
+			if (size - 1 - index < index)
+				for (node = tail, index = size - 1 - index; index > 0;
+					index--)
+					node = node->prev;
+			else
+				for (; index > 0; index--)
+					node = node->next;
+			return node;
+		}
+	};
+
+	template<class Node>
+	class CachedIndexing
+	{
+	public:
+		CachedIndexing() : m_finger(nullptr), m_fingerIndex(0),
+			m_skipStride(1) {}
+		// A copy starts with empty caches; they point into another list.
+		CachedIndexing(const CachedIndexing&) : m_finger(nullptr),
+			m_fingerIndex(0), m_skipStride(1) {}
+		CachedIndexing& operator=(const CachedIndexing&)
+		{
+			invalidate();
+			return *this;
+		}
+
+		// Every index moves up one, so only the finger survives.
+		void pushed_front()
+		{
+			if (m_finger != nullptr)
+				m_fingerIndex++;
+			m_skip.clear();
+		}
+		void popping_front(const Node* head)
+		{
+			if (m_finger == head)
+				m_finger = nullptr;
+			else if (m_finger != nullptr)
+				m_fingerIndex--;
+			m_skip.clear();
+		}
+		// size is the size once tail is gone; skip entries past it go.
+		void popping_back(const Node* tail, unsigned size)
+		{
+			if (m_finger == tail)
+				m_finger = nullptr;
+			while (!m_skip.empty() &&
+				(m_skip.size() - 1) * static_cast<unsigned>(m_skipStride) >=
+				size)
+				m_skip.pop_back();
+		}
+		void invalidate() const
+		{
+			m_finger = nullptr;
+			m_skip.clear();
+		}
+		Node* find(Node* head, Node* tail, int size, int index) const;
+	private:
+		void build(Node* head, int size) const;
+
+		// Properties:
+		mutable Node* m_finger; // node found by the last lookup
+		mutable int m_fingerIndex; // its index
+		mutable vector<Node*> m_skip; // every m_skipStride-th node
+		mutable int m_skipStride;
+	}; // End CachedIndexing class declarations.
+
+	//------------------------------------------------------------------------
+	//	Method:			Node* CachedIndexing<Node>::find(Node* head,
+	//						Node* tail, int size, int index) const
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Finds the node at index.  The walk starts from
+	//						whichever of the head, the tail, the node found
+	//						by the last call (the finger) and the nearest
+	//						skip index entry is closest, and the node found
+	//						becomes the new finger.  Sequential and
+	//						near-sequential access is therefore O(1) per
+	//						call.  When none of those is within sqrt(n)
+	//						nodes, the skip index is built (O(n), once until
+	//						the list next changes shape) so random access
+	//						costs O(sqrt(n)).
+	//	Parameters:		Node* head, Node* tail- the list's ends.
+	//					int size- the number of nodes.
+	//					int index- the index wanted, in [0, size).
+	//	Returns:		A pointer to the node.
+	//	Calls:			build()
+	//	Called by:		List's node_at method
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0, moved out
+	//										of List::node_at().
+	//------------------------------------------------------------------------
+	template <class Node>
+	Node* CachedIndexing<Node>::find(Node* head, Node* tail, int size,
+		int index) const
+	{
+		// Start from the closest of the head, the tail and the finger.
+		Node* node = head;
+		int at = 0;
+		if (size - 1 - index < index)
+		{
+			node = tail;
+			at = size - 1;
+		}
+		if (m_finger != nullptr &&
+			abs(index - m_fingerIndex) < abs(index - at))
+		{
+			node = m_finger;
+			at = m_fingerIndex;
+		}
+		// Too far from all of them: hop in through the skip index.
+		long long distance = abs(index - at);
+		if (distance * distance > size)
+		{
+			if (m_skip.empty())
+				build(head, size);
+			int entry = index / m_skipStride;
+			if (entry >= static_cast<int>(m_skip.size()))
+				entry = static_cast<int>(m_skip.size()) - 1;
+			if (index - entry * m_skipStride < abs(index - at))
+			{
+				node = m_skip[entry];
+				at = entry * m_skipStride;
+			}
+		}
+		for (; at < index; at++)
+			node = node->next;
+		for (; at > index; at--)
+			node = node->prev;
+		m_finger = node;
+		m_fingerIndex = index;
+		return node;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void CachedIndexing<Node>::build(Node* head,
+	//						int size) const
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Records every sqrt(n)-th node in m_skip in a single
+	//						pass over the list.
+	//	Parameters:		Node* head- the list's first node.
+	//					int size- the number of nodes.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		find()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0, moved out
+	//										of List::build_skip_index().
+	//------------------------------------------------------------------------
+	template <class Node>
+	void CachedIndexing<Node>::build(Node* head, int size) const
+	{
+		m_skipStride = static_cast<int>(sqrt(static_cast<double>(size)));
+		if (m_skipStride < 1)
+			m_skipStride = 1;
+		m_skip.reserve(size / m_skipStride + 1);
+		Node* node = head;
+		for (int i = 0; i < size; i++, node = node->next)
+			if (i % m_skipStride == 0)
+				m_skip.push_back(node);
+	}
+
+	// The iterator shared by every List<DataType, ...>.  List and Queue
+	//	export it as their nested iterator typedef.  It meets the
+	//	bidirectional iterator requirements, so <algorithm> can use it, but
+	//	note that end() is the tail, not one past it.
+	template<class DataType, class Checking = DefaultIteratorChecking>
+	class ListIterator
+	{
+		static const bool unchecked =
+			noexcept(Checking::check(nullptr, nullptr));
+	public:
+		typedef ListElem<DataType> listelem;
+		typedef bidirectional_iterator_tag iterator_category;
+		typedef DataType value_type;
+		typedef ptrdiff_t difference_type;
+		typedef DataType* pointer;
+		typedef DataType& reference;
+
+		ListIterator(listelem* p = nullptr) noexcept : ptr(p){}
+		// Prefix increment
+		ListIterator& operator++() noexcept(unchecked)
+		{
+			Checking::check(ptr,
+				"Could not increment the iterator: nullptr pointer");
+			ptr = ptr->next;
+			return *this;
+		}
+		// Prefix decrement
+		ListIterator& operator--() noexcept(unchecked)
+		{
+			Checking::check(ptr,
+				"Could not decrement the iterator: nullptr pointer");
+			ptr = ptr->prev;
+			return *this;
+		}
+		// Postfix increment
+		ListIterator operator++(int) noexcept(unchecked)
+		{
+			ListIterator temp = *this;
+			++*this;
+			return temp;
+		}
+		// Postfix decrement
+		ListIterator operator--(int) noexcept(unchecked)
+		{
+			ListIterator temp = *this;
+			--*this;
+			return temp;
+		}
+		pointer operator->() const noexcept(unchecked)
+		{
+			Checking::check(ptr,
+				"Could not retrieve data from an empty list.");
+			return &ptr->data;
+		}
+		reference operator*() const noexcept(unchecked)
+		{
+			Checking::check(ptr,
+				"Could not retrieve data from an empty list.");
+			return ptr->data;
+		}
+		operator listelem*() const noexcept { return ptr; }
+	private:
+		listelem* ptr; //current listelem or nullptr
+	};	// End ListIterator class declarations.
+
+	// A past-the-end iterator over a whole List, returned by cbegin(),
+	//	cend() and range().  It counts the nodes left in the lap instead of
+	//	comparing against the head, so the end is (head, 0) and one --
+	//	from it reaches the tail.  Value is DataType or const DataType.
+	template<class DataType, class Value>
+	class ListRangeIterator
+	{
+		template<class, class> friend class ListRangeIterator;
+	public:
+		typedef ListElem<DataType> listelem;
+		typedef bidirectional_iterator_tag iterator_category;
+		typedef typename remove_const<Value>::type value_type;
+		typedef ptrdiff_t difference_type;
+		typedef Value* pointer;
+		typedef Value& reference;
+
+		ListRangeIterator() noexcept : ptr(nullptr), left(0) {}
+		ListRangeIterator(listelem* p, unsigned n) noexcept
+			: ptr(p), left(n) {}
+		// Lets a range_iterator convert to a const_range_iterator.
+		template<class V, class = typename enable_if<
+			is_convertible<V*, Value*>::value>::type>
+		ListRangeIterator(const ListRangeIterator<DataType, V>& x) noexcept
+			: ptr(x.ptr), left(x.left) {}
+		ListRangeIterator& operator++() noexcept
+		{
+			ptr = ptr->next;
+			--left;
+			return *this;
+		}
+		ListRangeIterator& operator--() noexcept
+		{
+			ptr = ptr->prev;
+			++left;
+			return *this;
+		}
+		ListRangeIterator operator++(int) noexcept
+		{
+			ListRangeIterator temp = *this;
+			++*this;
+			return temp;
+		}
+		ListRangeIterator operator--(int) noexcept
+		{
+			ListRangeIterator temp = *this;
+			--*this;
+			return temp;
+		}
+		reference operator*() const noexcept { return ptr->data; }
+		pointer operator->() const noexcept { return &ptr->data; }
+		bool operator==(const ListRangeIterator& x) const noexcept
+			{ return left == x.left; }
+		bool operator!=(const ListRangeIterator& x) const noexcept
+			{ return left != x.left; }
+	private:
+		listelem* ptr; // current listelem, or the head at the end
+		unsigned left; // nodes from here to the end of the lap
+	};	// End ListRangeIterator class declarations.
+
+	// A begin/end pair for range-for, returned by List::range().
+	template<class Iterator>
+	struct ListRange
+	{
+		Iterator first;
+		Iterator last;
+		Iterator begin() const { return first; }
+		Iterator end() const { return last; }
+	};
+
+	// The base List derives from, selected by its Dispatch policy.
+	template<class DataType, class Dispatch>
+	class ListDispatch;
+
+	template<class DataType>
+	class ListDispatch<DataType, DynamicDispatch>
+	{
+	public:
+		virtual ~ListDispatch() {}
+		virtual unsigned getSize() const = 0;
+		virtual ListIterator<DataType> begin() const = 0;
+		virtual ListIterator<DataType> end() const = 0;
+		virtual bool empty() const = 0;
+	};
+
+	template<class DataType>
+	class ListDispatch<DataType, StaticDispatch>
+	{
+	protected:
+		~ListDispatch() {}
+	};
+
+	template<class DataType, class Alloc = allocator<DataType>,
+		class Dispatch = DynamicDispatch>
+	class List : public ListDispatch<DataType, Dispatch>
+	{
+		typedef typename conditional<DL_CDLL_INDEX_CACHE != 0,
+			CachedIndexing<ListElem<DataType> >,
+			PlainIndexing<ListElem<DataType> > >::type index_cache;
+		static const bool unchecked_access =
+			noexcept(DefaultAccessChecking::check(nullptr, nullptr));
+		static const bool nothrow_move =
+			is_nothrow_move_constructible<DataType>::value &&
+			is_nothrow_move_assignable<DataType>::value;
+	public:
+		typedef ListElem<DataType> listelem;
+		typedef ListIterator<DataType> iterator;
+		typedef ListRangeIterator<DataType, DataType> range_iterator;
+		typedef ListRangeIterator<DataType, const DataType>
+			const_range_iterator;
+
+		// constructors
+		List() : head(nullptr), tail(nullptr), m_size(0) {}
+		explicit List(const Alloc& alloc)
+			: head(nullptr), tail(nullptr), m_size(0), m_alloc(alloc) {}
+		List(size_t n_elements, DataType datum, const Alloc& alloc = Alloc());
+		List(const List& x);
+		List(List&& x) noexcept;
+		List(iterator b, iterator e, const Alloc& alloc = Alloc());
+
+		// Destructor
+		~List() { release(); }
+
+		// Public methods:
+		unsigned getSize() const { return m_size; }
+		iterator begin() const { return head; }
+		iterator end() const { return tail; }
+		const_range_iterator cbegin() const
+			{ return const_range_iterator(head, m_size); }
+		const_range_iterator cend() const
+			{ return const_range_iterator(head, 0); }
+		ListRange<range_iterator> range()
+		{
+			ListRange<range_iterator> r =
+				{ range_iterator(head, m_size), range_iterator(head, 0) };
+			return r;
+		}
+		ListRange<const_range_iterator> range() const
+		{
+			ListRange<const_range_iterator> r = { cbegin(), cend() };
+			return r;
+		}
+		void push_front(const DataType& datum);
+		void push_front(DataType&& datum)
+			{ link_front(create_node(std::move(datum))); }
+		template<class... Args>
+		DataType& emplace_front(Args&&... args)
+		{
+			listelem* node = create_node(std::forward<Args>(args)...);
+			link_front(node);
+			return node->data;
+		}
+		DataType pop_front();
+		void push_back(const DataType& datum);
+		void push_back(DataType&& datum)
+			{ link_back(create_node(std::move(datum))); }
+		template<class... Args>
+		DataType& emplace_back(Args&&... args)
+		{
+			listelem* node = create_node(std::forward<Args>(args)...);
+			link_back(node);
+			return node->data;
+		}
+		DataType pop_back();
+		bool try_pop_front(DataType& out) noexcept(nothrow_move)
+		{
+			if (empty())
+				return false;
+			out = pop_front();
+			return true;
+		}
+		bool try_pop_back(DataType& out) noexcept(nothrow_move)
+		{
+			if (empty())
+				return false;
+			out = pop_back();
+			return true;
+		}
+		DataType& front() const noexcept(unchecked_access);
+		DataType& back() const noexcept(unchecked_access);
+		bool empty()const 
+			{ return head == nullptr || tail == nullptr; }
+		void release();
+		List& operator=(const List& rlist);
+		List& operator=(List&& rlist);
+		DataType& operator[](int index);
+		const DataType& operator[](int index) const;
+		void splice(iterator pos, List& x);
+		void splice(iterator pos, List& x, iterator it);
+		void splice(iterator pos, List& x, iterator first,
+			iterator last);
+		void concat(List& x) { splice(iterator(), x); }
+		List<DataType, Alloc, Dispatch> split_at(iterator pos);
+		template<class InputIt>
+		void push_range(InputIt first, InputIt last);
+		void push_n(size_t n, const DataType& datum);
+		template<class OutputIt>
+		OutputIt pop_n(OutputIt out, size_t n);
+		void drain_into(List& x) { x.concat(*this); }
+		iterator insert(iterator pos, const DataType& datum)
+			{ return emplace(pos, datum); }
+		iterator insert(iterator pos, DataType&& datum)
+			{ return emplace(pos, std::move(datum)); }
+		template<class... Args>
+		iterator emplace(iterator pos, Args&&... args)
+		{
+			listelem* node = create_node(std::forward<Args>(args)...);
+			link_range(pos, node, node, 1);
+			return node;
+		}
+		iterator erase(iterator pos);
+		void rotate(int k = 1);
+		iterator advance(iterator pos, int k) const;
+		void sort() { sort(less<DataType>()); }
+		template<class Compare>
+		void sort(Compare comp);
+		void merge(List& x) { merge(x, less<DataType>()); }
+		template<class Compare>
+		void merge(List& x, Compare comp);
+		Alloc get_allocator() const { return Alloc(m_alloc); }
+	private:
+		// Nodes are allocated through Alloc rebound to listelem.
+		typedef typename allocator_traits<Alloc>::template
+			rebind_alloc<listelem> node_allocator;
+		typedef allocator_traits<node_allocator> node_traits;
+
+		template<class... Args>
+		listelem* create_node(Args&&... args);
+		void destroy_node(listelem* node);
+		void destroy_chain(listelem* node);
+		void link_copies(const listelem* source, unsigned count);
+		// Lets an allocator with a reserve() member, such as PoolAllocator,
+		//	carve room for n nodes at once; other allocators are left alone.
+		template<class A>
+		static auto reserve_nodes(A& alloc, size_t n, int)
+			-> decltype(alloc.reserve(n), void()) { alloc.reserve(n); }
+		template<class A>
+		static void reserve_nodes(A&, size_t, long) {}
+		// Hands a nullptr-terminated chain to an allocator with a
+		//	deallocate_chain() member, such as PoolAllocator.  Returns false
+		//	if the allocator has none.
+		template<class A>
+		static auto deallocate_nodes(A& alloc, listelem* first,
+			listelem* last, size_t n, int)
+			-> decltype(alloc.deallocate_chain(first, last, n), bool())
+			{ alloc.deallocate_chain(first, last, n); return true; }
+		template<class A>
+		static bool deallocate_nodes(A&, listelem*, listelem*, size_t, long)
+			{ return false; }
+		void link_front(listelem* node);
+		void link_back(listelem* node);
+		void link_range(listelem* pos, listelem* first, listelem* last,
+			unsigned count);
+		void unlink_range(listelem* first, listelem* last, unsigned count);
+		template<class Compare>
+		static void merge_chains(listelem*& a, listelem* b, Compare& comp);
+		static listelem* join_chains(listelem* a, listelem* b);
+		void adopt_chain(listelem* first);
+		listelem* node_at(int index) const;
+		void invalidate_index() const { m_indexing.invalidate(); }
+
+		// Properties:
+		listelem *head;
+		listelem *tail;
+		unsigned m_size; // number of elements in the list
+		node_allocator m_alloc; // allocates and frees each listelem
+		index_cache m_indexing; // operator[] caches, if any
+	}; // End List class declarations.
+
+	template<class DataType, class Alloc = allocator<DataType>,
+		class Dispatch = DynamicDispatch>
+	class RoundRobinCursor
+	{
+	public:
+		typedef List<DataType, Alloc, Dispatch> list_type;
+		typedef typename list_type::iterator iterator;
+
+		explicit RoundRobinCursor(list_type& list) : m_list(&list) {}
+
+		DataType& current() { return *position(); }
+		DataType& next()
+		{
+			DataType& datum = *position();
+			++m_pos;
+			return datum;
+		}
+		void advance(int k) { m_pos = m_list->advance(position(), k); }
+		iterator position();
+		void erase() { m_pos = m_list->erase(position()); }
+		void reset() { m_pos = iterator(); }
+	private:
+		// Properties:
+		list_type* m_list;
+		iterator m_pos; // the current element, or iterator() for the head
+	};
+
+	// Here is the declaration for the overloaded output operator used by the 
+	//	List class:
+	template <class DataType, class Alloc, class Dispatch>
+	ostream& operator<<(ostream& sout,
+		const List<DataType, Alloc, Dispatch>& x);
+
+	// Definitions for the List class now follow.
+
+	//------------------------------------------------------------------------
+	//	Method:			List<DataType>::List(size_t n_elements,DataType datum,
+	//						const Alloc& alloc)
+	//	Version			1.2
+	//	Date			10/17/2026
+	//	Description:	Constructor that fills the list with a quantity of
+	//						n_elements DataTypes.
+	//	Parameters:		size_t n_elements- the quantity of items to fill the
+	//						List with.
+	//					DataType datum- the data to fill the List with.
+	//					const Alloc& alloc- the allocator for the nodes.
+	//	Returns:		None
+	//	Calls:			push_front()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		4/15/2011	PB	completed version 0.7
+	//					4/29/2016	DL	completed version 0.8, adapting the 
+	//										code to the template class
+	//										List<DataType>.
+	//					5/13/2016	DL	completed version 1.0.
+	//					5/19/2016	DL	completed version 1.1, writing a
+	//										more specific exception throw
+	//										message.
+	//					10/17/2026	DL	completed version 1.2, taking an
+	//										allocator for the nodes.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	List<DataType, Alloc, Dispatch>::List(size_t n_elements, DataType datum,
+		const Alloc& alloc)
+		:head(nullptr), tail(nullptr), m_size(0), m_alloc(alloc)
+	{
+		if (n_elements <= 0)
+			throw out_of_range("Could not create List object: Empty list");
+		for (size_t i = 0; i < n_elements; ++i)
+		{
+			push_front(datum);
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			List<DataType>::List(const List& source)
+	//	Version			1.2
+	//	Date			10/17/2026
+	//	Description:	Copy constructor.  The nodes are allocated with a copy
+	//						of source's allocator and linked in as one chain.
+	//	Parameters:		const List& source- the List to copy from.
+	//	Returns:		None
+	//	Calls:			link_copies()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		4/15/2011	PB	completed version 0.4
+	//					4/29/2016	DL	completed version 0.5, adapting the 
+	//										code to the List<DataType>
+	//										template class.
+	//					5/13/2016	DL	completed version 1.0, fixing memory-
+	//										related bugs.
+	//					10/17/2026	DL	completed version 1.1, copying the
+	//										allocator.
+	//					10/17/2026	DL	completed version 1.2, copying in
+	//										one pass with link_copies(), which
+	//										also fixes copying an empty list.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	List<DataType, Alloc, Dispatch>::List(const List& source)
+		: head(nullptr), tail(nullptr), m_size(0),
+		m_alloc(node_traits::select_on_container_copy_construction
+			(source.m_alloc))
+	{
+		link_copies(source.head, source.m_size);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			List<DataType>::List(List&& source)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Move constructor.  Takes over source's nodes without
+	//						copying any data, leaving source empty.
+	//	Parameters:		List&& source- the List to move from.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, marking it
+	//										noexcept so that vector moves
+	//										lists instead of copying them.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	List<DataType, Alloc, Dispatch>::List(List&& source)
+		noexcept
+		: head(source.head), tail(source.tail), m_size(source.m_size),
+		m_alloc(source.m_alloc)
+	{
+		source.head = source.tail = nullptr;
+		source.m_size = 0;
+		source.invalidate_index();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			List<DataType>::List(iterator b, iterator e,
+	//						const Alloc& alloc)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	constructor using iterators, copies from b to one 
+	//						before e
+	//	Parameters:		iterator b- the begin iterator.
+	//					iterator e- the end iterator.
+	//					const Alloc& alloc- the allocator for the nodes.
+	//	Returns:		None
+	//	Calls:			push_back()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		4/15/2011	PB	completed version 0.7
+	//					4/29/2016	DL	completed version 0.8, adapting it to 
+	//										the template class List<DataType>.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, taking an
+	//										allocator for the nodes.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	List<DataType, Alloc, Dispatch>::List(iterator b, iterator e,
+		const Alloc& alloc)
+		:head(nullptr), tail(nullptr), m_size(0), m_alloc(alloc)
+	{
+		while (b != e)
+			push_back(*b++);
+		push_back(*b);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::release()
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	empties the list in a single pass.  The circle is
+	//						broken at the tail and the nodes are destroyed
+	//						and freed straight down the chain, with no
+	//						per-node relinking or size updates.  When
+	//						DataType needs no destructor and the allocator
+	//						can take back a whole chain (PoolAllocator), the
+	//						nodes are not visited at all: the chain becomes
+	//						part of the pool's free list in O(1).
+	//	Parameters:		None
+	//	Returns:		None
+	//	Calls:			invalidate_index()
+	//					deallocate_nodes()
+	//					destroy_chain()
+	//	Called by:		~List() (the destructor)
+	//					operator=
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		4/15/2011	PB	completed version 0.8
+	//					4/29/2016	DL	completed version 0.9, adapting it to 
+	//										the template class List<DataType>.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, freeing the
+	//										nodes in one pass instead of
+	//										popping each one.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::release()
+	{
+		if (head == nullptr)
+			return;
+		listelem* first = head;
+		listelem* last = tail;
+		unsigned count = m_size;
+		last->next = nullptr;
+		head = tail = nullptr;
+		m_size = 0;
+		invalidate_index();
+		// The chain doubles as a free list only if next is the first word
+		//	of each node and nothing has to run when a node dies.
+		if (is_trivially_destructible<DataType>::value &&
+			is_standard_layout<listelem>::value &&
+			deallocate_nodes(m_alloc, first, last, count, 0))
+			return;
+		destroy_chain(first);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::push_front
+	//						(const DataType& datum)
+	//	Version			1.2
+	//	Date			10/17/2026
+	//	Description:	insert element at front of list
+	//	Parameters:		const DataType& datum- the data to insert
+	//	Returns:		None
+	//	Calls:			create_node()
+	//					link_front()
+	//	Called by:		Fill constructor
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		4/15/2011	PB	completed version 0.8
+	//					4/29/2016	DL	copied from PB's list push_front
+	//										method and changed it to 
+	//										List<DataType> push_front.
+	//					5/4/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, allocating
+	//										the node through the allocator.
+	//					10/17/2026	DL	completed version 1.2, taking datum
+	//										by reference and moving the
+	//										linking into link_front().
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::push_front(const DataType& datum)
+	{
+		link_front(create_node(datum));
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::link_front(listelem* node)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	links an unlinked node in at the front of the list
+	//	Parameters:		listelem* node- the node to link in
+	//	Returns:		None
+	//	Calls:			empty()
+	//	Called by:		push_front()
+	//					emplace_front()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0, split out of
+	//										push_front().
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::link_front(listelem* node)
+	{
+		m_indexing.pushed_front();
+		m_size++;
+		if (!empty())
+		{ // was a nonempty list
+			node->prev = tail;
+			node->next = head;
+			head->prev = node;
+			head = node;
+			tail->next = head;
+		}
+		else
+		{
+			node->prev = node;
+			node->next = node;
+			head = tail = node;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::push_back
+	//						(const DataType& datum)
+	//	Version			1.2
+	//	Date			10/17/2026
+	//	Description:	insert element at end of list
+	//	Parameters:		const DataType& datum- the item to insert
+	//	Returns:		None
+	//	Calls:			create_node()
+	//					link_back()
+	//	Called by:		Copy Constructor
+	//					Iterator constructor
+	//					operator=
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		5/2/2016	DL	completed version 0.5, but seems to 
+	//										have gotten the pointers in the 
+	//										incorrect order.
+	//					5/4/2016	DL	completed version 0.9.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, allocating
+	//										the node through the allocator.
+	//					10/17/2026	DL	completed version 1.2, taking datum
+	//										by reference and moving the
+	//										linking into link_back().
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::push_back(const DataType& datum)
+	{
+		link_back(create_node(datum));
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::link_back(listelem* node)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	links an unlinked node in at the end of the list
+	//	Parameters:		listelem* node- the node to link in
+	//	Returns:		None
+	//	Calls:			empty()
+	//	Called by:		push_back()
+	//					emplace_back()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0, split out of
+	//										push_back().
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::link_back(listelem* node)
+	{
+		m_size++;
+		if (!empty())
+		{ // was a nonempty list
+			node->prev = tail;
+			node->next = head;
+			tail->next = node;
+			tail = node;
+			head->prev = tail;
+		}
+		else
+		{
+			node->prev = node;
+			node->next = node;
+			head = tail = node;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			List<DataType>& List<DataType>::operator=
+	//						(const List<DataType>& rlist)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Sets the contents of this list to those of rlist.
+	//						The nodes this list already has are reused: their
+	//						data is assigned over in one pass, any extra
+	//						nodes are unlinked as one chain and freed, and
+	//						any missing ones are copied onto the back as one
+	//						chain.
+	//	Parameters:		const List<DataType>& rlist- the List to copy from.
+	//	Returns:		A reference to this List.
+	//	Calls:			release()
+	//					unlink_range()
+	//					destroy_chain()
+	//					link_copies()
+	//	Called by:		Queue::operator=
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's copy
+	//						constructor or assignment throws.  The list then
+	//						holds a valid mix of old and copied data.
+	//	Changelog		4/15/2011	PB completed version 0.5
+	//					4/29/2016	DL	completed version 0.6, adapting the 
+	//										code to fit the mold of the 
+	//										template class List<DataType>.
+	//					5/4/2016	DL	completed version 0.8, correcting the
+	//										order of list elements copied to
+	//										the new list.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, reusing this
+	//										list's nodes and returning by
+	//										reference instead of copying the
+	//										whole list a second time.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	List<DataType, Alloc, Dispatch>& List<DataType, Alloc, Dispatch>::operator=
+		(const List<DataType, Alloc, Dispatch>& rlist)
+	{
+		if (&rlist == this)
+			return *this;
+		if (node_traits::propagate_on_container_copy_assignment::value &&
+			m_alloc != rlist.m_alloc)
+		{ // the old nodes must go back to the old allocator
+			release();
+			m_alloc = rlist.m_alloc;
+		}
+		unsigned common = (m_size < rlist.m_size) ? m_size : rlist.m_size;
+		listelem* node = head;
+		const listelem* source = rlist.head;
+		for (unsigned i = 0; i < common; i++)
+		{
+			node->data = source->data;
+			node = node->next;
+			source = source->next;
+		}
+		if (m_size > common)
+		{ // free the extra nodes, node through the tail
+			listelem* last = tail;
+			unlink_range(node, last, m_size - common);
+			last->next = nullptr;
+			destroy_chain(node);
+		}
+		else if (rlist.m_size > common)
+			link_copies(source, rlist.m_size - common);
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			List<DataType>& List<DataType>::operator=
+	//						(List<DataType>&& rlist)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Move assignment.  Takes over rlist's nodes when the
+	//						two allocators can free each other's nodes;
+	//						otherwise moves the data over one element at a
+	//						time.  rlist is left empty either way.
+	//	Parameters:		List<DataType>&& rlist- the List to move from.
+	//	Returns:		A reference to this List.
+	//	Calls:			release()
+	//					push_back()
+	//					pop_front()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	List<DataType, Alloc, Dispatch>& List<DataType, Alloc, Dispatch>::operator=
+		(List<DataType, Alloc, Dispatch>&& rlist)
+	{
+		if (&rlist != this)
+		{
+			release();
+			if (node_traits::propagate_on_container_move_assignment::value)
+				m_alloc = rlist.m_alloc;
+			if (m_alloc == rlist.m_alloc)
+			{ // the nodes can change hands
+				head = rlist.head;
+				tail = rlist.tail;
+				m_size = rlist.m_size;
+				rlist.head = rlist.tail = nullptr;
+				rlist.m_size = 0;
+				rlist.invalidate_index();
+			}
+			else
+			{
+				while (!rlist.empty())
+					push_back(rlist.pop_front());
+			}
+		}
+		return *this;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType List<DataType>::pop_front()
+	//	Version			1.4
+	//	Date			10/17/2026
+	//	Description:	removes front element and returns the data from that 
+	//						element
+	//	Parameters:		None
+	//	Returns:		A DataType equal to the item being popped.
+	//	Calls:			begin()
+	//					empty()
+	//					destroy_node()
+	//	Called by:		release()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		4/15/2011	PB	completed version 0.7
+	//					4/30/2016	DL	completed version 0.8, adapting the 
+	//										code to the template class 
+	//										List<DataType>.
+	//					5/13/2016	DL	completed version 1.0, fixing memory-
+	//										related bugs.
+	//					5/19/2016	DL	completed version 1.1, adding clearer
+	//										exception throw message.
+	//					10/17/2026	DL	completed version 1.2, freeing the
+	//										node through the allocator.
+	//					10/17/2026	DL	completed version 1.3, moving the
+	//										data out instead of copying it.
+	//					10/17/2026	DL	completed version 1.4, keeping the
+	//										operator[] caches valid.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	DataType List<DataType, Alloc, Dispatch>::pop_front()
+	{
+		if (head == nullptr)
+			throw runtime_error("Could not remove front item: Empty list");
+		m_indexing.popping_front(head);
+		m_size--;
+		DataType data = std::move(head->data);
+		iterator temp = begin();
+		temp++;
+		destroy_node(head);
+		if (m_size == 0)
+			head = nullptr;
+		if (!empty())
+		{
+			head = temp;
+			head->prev = tail;
+			tail->next = head;
+		}
+		else
+			head = tail = nullptr; // empty at both ends
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType List<DataType>::pop_back()
+	//	Version			1.4
+	//	Date			10/17/2026
+	//	Description:	removes back element and returns the data from that 
+	//						element
+	//	Parameters:		None
+	//	Returns:		A DataType that equals the item being popped.
+	//	Calls:			iterator::end()
+	//					empty()
+	//					destroy_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		5/5/2016	DL	completed version 0.4
+	//					5/5/2016	DL	completed version 0.8, fixing the
+	//										iterator.
+	//					5/13/2016	DL	completed version 1.0, fixing memory-
+	//										related bugs.
+	//					5/19/2016	DL	completed version 1.1, writing a
+	//										more specific exception throw
+	//										message.
+	//					10/17/2026	DL	completed version 1.2, freeing the
+	//										node through the allocator.
+	//					10/17/2026	DL	completed version 1.3, moving the
+	//										data out instead of copying it.
+	//					10/17/2026	DL	completed version 1.4, keeping the
+	//										operator[] caches valid.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	DataType List<DataType, Alloc, Dispatch>::pop_back()
+	{
+		if (tail == nullptr)
+			throw runtime_error
+			("Could not remove item from the back: Empty list");
+		m_size--;
+		m_indexing.popping_back(tail, m_size);
+		DataType data = std::move(tail->data);
+		iterator temp = end();
+		temp--;
+		destroy_node(tail);
+		if (m_size == 0)
+			tail = nullptr;
+		if (!empty())
+		{
+			tail = temp;
+			tail->next = head;
+			head->prev = tail;
+		}
+		else
+			head = tail = nullptr; // empty at both ends
+		return data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& front() const
+	//	Version:		1.2
+	//	Date:			10/17/2026
+	//	Description:	Returns the data value within the head.
+	//	Parameters:		None
+	//	Returns:		head->data
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error, unless DL_CDLL_CHECKED_ACCESS is
+	//						0.
+	//	Changelog:		5/13/2016	DL	completed version 1.0
+	//					5/19/2016	DL	completed version 1.1, correcting a
+	//										program-breaking bug when
+	//										attempting to access the head of
+	//										an empty list.
+	//					10/17/2026	DL	completed version 1.2, checking
+	//										through DefaultAccessChecking.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	DataType& List<DataType, Alloc, Dispatch>::front() const
+		noexcept(unchecked_access)
+	{
+		DefaultAccessChecking::check(head,
+			"Could not access the front value of an empty list.");
+		return head->data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& back() const
+	//	Version:		1.2
+	//	Date:			10/17/2026
+	//	Description:	Returns the data value within the tail.
+	//	Parameters:		None
+	//	Returns:		tail->data
+	//	Calls:			None
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error, unless DL_CDLL_CHECKED_ACCESS is
+	//						0.
+	//	Changelog:		5/13/2016	DL	completed version 1.0
+	//					5/19/2016	DL	completed version 1.1, correcting a
+	//										program-breaking bug when
+	//										attempting to access the tail of
+	//										an empty list.
+	//					10/17/2026	DL	completed version 1.2, checking
+	//										through DefaultAccessChecking.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	DataType& List<DataType, Alloc, Dispatch>::back() const
+		noexcept(unchecked_access)
+	{
+		DefaultAccessChecking::check(tail,
+			"Could not access the back value of an empty list.");
+		return tail->data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			DataType& List<DataType>::operator[](int index)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	[] operator -- Modifiable l-value
+	//	Parameters:		int index- An integer used to get the index of the
+	//						desired item.
+	//	Returns:		DataType&, a reference to the data contained at the
+	//						index.
+	//	Calls:			node_at()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		4/15/1011	PB	completed version 0.6
+	//					4/30/2016	DL	completed version 0.7, adapting the 
+	//										code to the template class 
+	//										List<DataType>.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, finding the
+	//										node through node_at().
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	DataType& List<DataType, Alloc, Dispatch>::operator[](int index)
+	{
+		return node_at(index)->data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			const DataType& List<DataType>::operator[](int index)
+	//						const
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	[] operator -- Non-modifiable r-value
+	//	Parameters:		int index- An integer used to get the index of the
+	//						desired item.
+	//	Returns:		A const DataType&; a reference to the item.
+	//	Calls:			node_at()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		4/15/2011	PB	completed version 0.6
+	//					4/30/2016	DL	completed version 0.7, adapting the 
+	//										code to the template class 
+	//										List<DataType>.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, finding the
+	//										node through node_at(), which
+	//										also fixes negative indices
+	//										counting the wrong way.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	const DataType& List<DataType, Alloc, Dispatch>::operator[](int index)const
+	{
+		return node_at(index)->data;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			listelem* List<DataType>::node_at(int index) const
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Finds the node at index (negative indices count back
+	//						from the tail), through m_indexing.  With the
+	//						default PlainIndexing that is a walk from the
+	//						nearer end; CachedIndexing starts from the
+	//						closest of the ends, its finger and its skip
+	//						index.
+	//	Parameters:		int index- the index of the desired node.
+	//	Returns:		A pointer to the node.
+	//	Calls:			m_indexing.find()
+	//	Called by:		operator[]
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			out_of_range
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, moving the
+	//										finger and skip index into
+	//										CachedIndexing.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	typename List<DataType, Alloc, Dispatch>::listelem*
+		List<DataType, Alloc, Dispatch>::node_at(int index) const
+	{
+		int size = static_cast<int>(m_size);
+		if (index < 0)
+		{
+			if (index < -size)
+				throw out_of_range("index out-of-range");
+			index = size + index;
+		}
+		else
+		{
+			if (index >= size)
+				throw out_of_range("index out-of-range");
+		}
+		return m_indexing.find(head, tail, size, index);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::splice(iterator pos,
+	//						List<DataType>& x)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves every node of x in ahead of pos without
+	//						allocating or copying.  A default (nullptr)
+	//						iterator for pos moves them in at the back.  x is
+	//						left empty.  This is O(1) unless the two
+	//						allocators cannot free each other's nodes, in
+	//						which case the data is moved over one element at
+	//						a time.
+	//	Parameters:		iterator pos- the node to insert ahead of, or
+	//						iterator() for the back of the list.
+	//					List<DataType>& x- the list to take the nodes from.
+	//	Returns:		None
+	//	Calls:			unlink_range()
+	//					link_range()
+	//	Called by:		concat()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::splice(iterator pos, List& x)
+	{
+		if (&x == this || x.head == nullptr)
+			return;
+		if (m_alloc == x.m_alloc)
+		{
+			listelem* first = x.head;
+			listelem* last = x.tail;
+			unsigned count = x.m_size;
+			x.unlink_range(first, last, count);
+			link_range(pos, first, last, count);
+		}
+		else
+		{
+			while (x.head != nullptr)
+			{
+				listelem* node = create_node(x.pop_front());
+				link_range(pos, node, node, 1);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::splice(iterator pos,
+	//						List<DataType>& x, iterator it)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves the single node at it out of x and in ahead of
+	//						pos, in O(1).  x may be this list.
+	//	Parameters:		iterator pos- the node to insert ahead of, or
+	//						iterator() for the back of the list.
+	//					List<DataType>& x- the list that holds it.
+	//					iterator it- the node to move.
+	//	Returns:		None
+	//	Calls:			splice(iterator, List&, iterator, iterator)
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::splice(iterator pos, List& x,
+		iterator it)
+	{
+		splice(pos, x, it, it);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::splice(iterator pos,
+	//						List<DataType>& x, iterator first, iterator last)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Moves the nodes from first through last (inclusive,
+	//						as with begin() and end()) out of x and in ahead
+	//						of pos.  The range may not run past x's tail, and
+	//						pos may not lie inside it.  Counting the moved
+	//						nodes takes O(k) for a range of k nodes; a single
+	//						node or the whole of x is moved in O(1).
+	//	Parameters:		iterator pos- the node to insert ahead of, or
+	//						iterator() for the back of the list.
+	//					List<DataType>& x- the list that holds the range.
+	//					iterator first- the first node to move.
+	//					iterator last- the last node to move.
+	//	Returns:		None
+	//	Calls:			unlink_range()
+	//					link_range()
+	//	Called by:		splice(iterator, List&, iterator)
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error, out_of_range
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::splice(iterator pos, List& x,
+		iterator first, iterator last)
+	{
+		listelem* f = first;
+		listelem* l = last;
+		if (f == nullptr || l == nullptr)
+			throw runtime_error("Could not splice: nullptr pointer");
+		unsigned count = 1;
+		if (f == x.head && l == x.tail)
+			count = x.m_size;
+		else
+		{
+			for (listelem* p = f; p != l; p = p->next, count++)
+				if (p == x.tail)
+					throw out_of_range
+					("Could not splice: range runs past the tail");
+		}
+		if (m_alloc == x.m_alloc)
+		{
+			x.unlink_range(f, l, count);
+			link_range(pos, f, l, count);
+		}
+		else
+		{
+			for (unsigned i = 0; i < count; i++)
+			{
+				listelem* next = f->next;
+				listelem* node = create_node(std::move(f->data));
+				link_range(pos, node, node, 1);
+				x.unlink_range(f, f, 1);
+				x.destroy_node(f);
+				f = next;
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			List<DataType> List<DataType>::split_at(iterator pos)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Splits the list in two without allocating any nodes.
+	//						The nodes from pos through the tail are moved into
+	//						the returned list, and this list keeps the nodes
+	//						ahead of pos.  The sizes are found by walking out
+	//						from pos toward both ends at once, so the cost is
+	//						O(min(k, n - k)) for a split k nodes from an end.
+	//	Parameters:		iterator pos- the first node of the second half.
+	//	Returns:		A List holding the nodes from pos through the tail.
+	//	Calls:			unlink_range()
+	//					link_range()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	List<DataType, Alloc, Dispatch>
+		List<DataType, Alloc, Dispatch>::split_at(iterator pos)
+	{
+		listelem* first = pos;
+		if (first == nullptr)
+			throw runtime_error("Could not split: nullptr pointer");
+		unsigned count;
+		listelem* forward = first;
+		listelem* backward = first;
+		unsigned ahead = 1; // nodes from first through forward
+		unsigned behind = 0; // nodes ahead of first, up to backward
+		while (true)
+		{
+			if (forward == tail)
+			{
+				count = ahead;
+				break;
+			}
+			if (backward == head)
+			{
+				count = m_size - behind;
+				break;
+			}
+			forward = forward->next;
+			ahead++;
+			backward = backward->prev;
+			behind++;
+		}
+		List<DataType, Alloc, Dispatch> result(get_allocator());
+		listelem* last = tail;
+		unlink_range(first, last, count);
+		result.link_range(nullptr, first, last, count);
+		return result;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::push_range(InputIt first,
+	//						InputIt last)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Adds copies of the items from first up to, but not
+	//						including, last at the back of the list.  The new
+	//						nodes are built into a chain first and linked in
+	//						with one seam fixup, so the list's size and caches
+	//						are only updated once for the whole batch.
+	//	Parameters:		InputIt first- the first item to add.
+	//					InputIt last- one past the last item to add.
+	//	Returns:		None
+	//	Calls:			create_node()
+	//					destroy_chain()
+	//					link_range()
+	//	Called by:		Queue::push_range()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  The list is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	template <class InputIt>
+	void List<DataType, Alloc, Dispatch>::push_range(InputIt first,
+		InputIt last)
+	{
+		listelem* chainFirst = nullptr;
+		listelem* chainLast = nullptr;
+		unsigned count = 0;
+		try
+		{
+			for (; first != last; ++first)
+			{
+				listelem* node = create_node(*first);
+				node->prev = chainLast;
+				if (chainLast == nullptr)
+					chainFirst = node;
+				else
+					chainLast->next = node;
+				chainLast = node;
+				count++;
+			}
+		}
+		catch (...)
+		{
+			destroy_chain(chainFirst);
+			throw;
+		}
+		if (count > 0)
+			link_range(nullptr, chainFirst, chainLast, count);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::push_n(size_t n,
+	//						const DataType& datum)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Adds n copies of datum at the back of the list,
+	//						building them into a chain and linking it in with
+	//						one seam fixup.
+	//	Parameters:		size_t n- the number of copies to add.
+	//					const DataType& datum- the data to copy.
+	//	Returns:		None
+	//	Calls:			create_node()
+	//					destroy_chain()
+	//					link_range()
+	//	Called by:		Queue::push_n()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's copy constructor
+	//						throws.  The list is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::push_n(size_t n,
+		const DataType& datum)
+	{
+		if (n == 0)
+			return;
+		listelem* chainFirst = nullptr;
+		listelem* chainLast = nullptr;
+		try
+		{
+			chainFirst = chainLast = create_node(datum);
+			for (size_t i = 1; i < n; i++)
+			{
+				listelem* node = create_node(datum);
+				node->prev = chainLast;
+				chainLast->next = node;
+				chainLast = node;
+			}
+		}
+		catch (...)
+		{
+			destroy_chain(chainFirst);
+			throw;
+		}
+		link_range(nullptr, chainFirst, chainLast, static_cast<unsigned>(n));
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			OutputIt List<DataType>::pop_n(OutputIt out,
+	//						size_t n)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Removes up to n items from the front of the list and
+	//						moves them out through out, in order.  The items
+	//						are unlinked as one chain with one seam fixup
+	//						before any of them is moved out.  Unlike
+	//						pop_front(), popping from an empty list is not an
+	//						error; nothing is written.
+	//	Parameters:		OutputIt out- where the items are written.
+	//					size_t n- the most items to remove.
+	//	Returns:		out, advanced past the last item written.
+	//	Calls:			unlink_range()
+	//					destroy_node()
+	//					destroy_chain()
+	//	Called by:		Queue::pop_n()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever writing through out throws.  The items
+	//						not yet written are lost if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	template <class OutputIt>
+	OutputIt List<DataType, Alloc, Dispatch>::pop_n(OutputIt out, size_t n)
+	{
+		if (n > m_size)
+			n = m_size;
+		if (n == 0)
+			return out;
+		listelem* node = head;
+		listelem* last = head;
+		for (size_t i = 1; i < n; i++)
+			last = last->next;
+		unlink_range(node, last, static_cast<unsigned>(n));
+		last->next = nullptr;
+		try
+		{
+			while (node != nullptr)
+			{
+				*out = std::move(node->data);
+				++out;
+				listelem* next = node->next;
+				destroy_node(node);
+				node = next;
+			}
+		}
+		catch (...)
+		{
+			destroy_chain(node);
+			throw;
+		}
+		return out;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			iterator List<DataType>::erase(iterator pos)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Removes and frees the node at pos, which must belong
+	//						to this list, in O(1).
+	//	Parameters:		iterator pos- the node to remove.
+	//	Returns:		An iterator to the node that followed pos (the head,
+	//						if pos was the tail), or iterator() if the list
+	//						is now empty.
+	//	Calls:			unlink_range()
+	//					destroy_node()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	typename List<DataType, Alloc, Dispatch>::iterator
+		List<DataType, Alloc, Dispatch>::erase(iterator pos)
+	{
+		listelem* node = pos;
+		if (node == nullptr)
+			throw runtime_error("Could not erase: nullptr pointer");
+		listelem* next = m_size > 1 ? node->next : nullptr;
+		unlink_range(node, node, 1);
+		destroy_node(node);
+		return next;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::rotate(int k)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Rotates the list so that the element k places after
+	//						the head becomes the head.  Only head and tail
+	//						move; no node is allocated, copied or relinked.
+	//						Rotating by 1 is a pop_front() and push_back()
+	//						without the free, the allocation or the copies.
+	//	Parameters:		int k- how far to rotate.  Negative rotates the
+	//						other way; any k is taken modulo the size.
+	//	Returns:		None
+	//	Calls:			advance()
+	//					invalidate_index()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::rotate(int k)
+	{
+		if (m_size < 2)
+			return;
+		head = advance(head, k);
+		tail = head->prev;
+		invalidate_index();
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			iterator List<DataType>::advance(iterator pos,
+	//						int k) const
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Walks k nodes around the circle from pos, which must
+	//						belong to this list.  k is reduced modulo the
+	//						size, then the walk goes forward or backward,
+	//						whichever is shorter, so it takes at most
+	//						m_size / 2 steps.  An empty list throws rather
+	//						than reducing k modulo 0.
+	//	Parameters:		iterator pos- the node to start from.
+	//					int k- how many nodes to move; negative moves
+	//						backward.
+	//	Returns:		An iterator to the node reached.
+	//	Calls:			None
+	//	Called by:		rotate()
+	//					RoundRobinCursor::advance()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, throws on an
+	//						empty list instead of dividing by zero.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	typename List<DataType, Alloc, Dispatch>::iterator
+		List<DataType, Alloc, Dispatch>::advance(iterator pos, int k) const
+	{
+		listelem* node = pos;
+		if (node == nullptr)
+			throw runtime_error("Could not advance: nullptr pointer");
+		if (m_size == 0)
+			throw runtime_error("Could not advance: Empty list");
+		int size = static_cast<int>(m_size);
+		k %= size;
+		if (k < 0)
+			k += size;
+		if (k <= size / 2)
+			for (; k > 0; k--)
+				node = node->next;
+		else
+			for (k = size - k; k > 0; k--)
+				node = node->prev;
+		return node;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::sort(Compare comp)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Sorts the list with a bottom-up merge sort that only
+	//						relinks nodes, so nothing is allocated, copied or
+	//						moved.  The circle is broken into a chain, and
+	//						each node is merged into runs of 1, 2, 4, ...
+	//						nodes held in bins[], which is the only extra
+	//						memory.  The prev links and the circle are put
+	//						back at the end.  The sort is stable.
+	//	Parameters:		Compare comp- a strict weak ordering, called as
+	//						comp(const DataType&, const DataType&).
+	//	Returns:		None
+	//	Calls:			merge_chains()
+	//					join_chains()
+	//					adopt_chain()
+	//	Called by:		sort()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever comp throws.  The list then keeps all of its
+	//						nodes, in an unspecified order.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	template <class Compare>
+	void List<DataType, Alloc, Dispatch>::sort(Compare comp)
+	{
+		if (m_size < 2)
+			return;
+		// bins[i] is nullptr or a sorted run of 2^i nodes; a higher bin
+		//	holds nodes from earlier in the list.
+		const int binCount = sizeof(unsigned) * 8 + 1;
+		listelem* bins[binCount] = {};
+		listelem* rest = head;
+		listelem* run = nullptr;
+		tail->next = nullptr;
+		try
+		{
+			while (rest != nullptr)
+			{
+				run = rest;
+				rest = rest->next;
+				run->next = nullptr;
+				int i = 0;
+				for (; bins[i] != nullptr; i++)
+				{
+					listelem* later = run;
+					run = nullptr;
+					merge_chains(bins[i], later, comp);
+					run = bins[i];
+					bins[i] = nullptr;
+				}
+				bins[i] = run;
+				run = nullptr;
+			}
+			for (int i = 0; i < binCount; i++)
+			{
+				if (bins[i] == nullptr)
+					continue;
+				listelem* later = run;
+				run = nullptr;
+				merge_chains(bins[i], later, comp);
+				run = bins[i];
+				bins[i] = nullptr;
+			}
+		}
+		catch (...)
+		{
+			listelem* all = join_chains(run, rest);
+			for (int i = 0; i < binCount; i++)
+				all = join_chains(bins[i], all);
+			adopt_chain(all);
+			throw;
+		}
+		adopt_chain(run);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::merge(List& x, Compare comp)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Merges x, which must be sorted by comp, into this
+	//						list, which must be too, leaving x empty.  The
+	//						nodes are relinked, not copied, unless the
+	//						allocators differ.  On equal items this list's
+	//						come first.
+	//	Parameters:		List& x- the list to merge in.
+	//					Compare comp- a strict weak ordering, called as
+	//						comp(const DataType&, const DataType&).
+	//	Returns:		None
+	//	Calls:			splice()
+	//					merge_chains()
+	//					adopt_chain()
+	//	Called by:		merge()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever comp throws.  This list then holds the
+	//						nodes of both, in an unspecified order.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	template <class Compare>
+	void List<DataType, Alloc, Dispatch>::merge(List& x, Compare comp)
+	{
+		if (&x == this || x.empty())
+			return;
+		if (!(m_alloc == x.m_alloc))
+		{
+			List moved(get_allocator());
+			moved.splice(iterator(), x);
+			merge(moved, comp);
+			return;
+		}
+		if (empty())
+		{
+			splice(iterator(), x);
+			return;
+		}
+		listelem* chain = head;
+		listelem* other = x.head;
+		tail->next = nullptr;
+		x.tail->next = nullptr;
+		m_size += x.m_size;
+		x.head = x.tail = nullptr;
+		x.m_size = 0;
+		x.invalidate_index();
+		try
+		{
+			merge_chains(chain, other, comp);
+		}
+		catch (...)
+		{
+			adopt_chain(chain);
+			throw;
+		}
+		adopt_chain(chain);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::link_range(listelem* pos,
+	//						listelem* first, listelem* last, unsigned count)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Links an unlinked chain of count nodes, first through
+	//						last, in ahead of pos, or at the back when pos is
+	//						nullptr.  Only the nodes at the two seams are
+	//						touched.
+	//	Parameters:		listelem* pos- the node to insert ahead of.
+	//					listelem* first- the first node of the chain.
+	//					listelem* last- the last node of the chain.
+	//					unsigned count- the number of nodes in the chain.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		splice()
+	//					split_at()
+	//					push_range(); push_n(); link_copies()
+	//					emplace(iterator, Args&&...)
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::link_range(listelem* pos,
+		listelem* first, listelem* last, unsigned count)
+	{
+		invalidate_index();
+		if (head == nullptr)
+		{
+			first->prev = last;
+			last->next = first;
+			head = first;
+			tail = last;
+		}
+		else
+		{
+			listelem* before = (pos == nullptr) ? tail : pos->prev;
+			listelem* after = before->next;
+			before->next = first;
+			first->prev = before;
+			last->next = after;
+			after->prev = last;
+			if (pos == head)
+				head = first;
+			if (pos == nullptr)
+				tail = last;
+		}
+		m_size += count;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::unlink_range(listelem* first,
+	//						listelem* last, unsigned count)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Unlinks the count nodes from first through last,
+	//						which may not run past the tail, leaving them as a
+	//						chain for link_range().  Nothing is freed.
+	//	Parameters:		listelem* first- the first node to unlink.
+	//					listelem* last- the last node to unlink.
+	//					unsigned count- the number of nodes in the range.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		splice()
+	//					split_at()
+	//					pop_n(); operator=; erase()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::unlink_range(listelem* first,
+		listelem* last, unsigned count)
+	{
+		invalidate_index();
+		if (count >= m_size)
+			head = tail = nullptr;
+		else
+		{
+			listelem* before = first->prev;
+			listelem* after = last->next;
+			before->next = after;
+			after->prev = before;
+			if (first == head)
+				head = after;
+			if (last == tail)
+				tail = before;
+		}
+		m_size -= count;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::merge_chains(listelem*& a,
+	//						listelem* b, Compare& comp)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Merges the sorted nullptr-terminated chains a and b
+	//						through next alone, taking from a on ties so the
+	//						merge is stable.  prev is left for adopt_chain().
+	//	Parameters:		listelem*& a- the earlier chain; set to the merged
+	//						chain.
+	//					listelem* b- the later chain.
+	//					Compare& comp- the ordering.
+	//	Returns:		None
+	//	Calls:			join_chains()
+	//	Called by:		sort()
+	//					merge()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			Whatever comp throws, after setting a to one chain
+	//						holding every node of a and b.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	template <class Compare>
+	void List<DataType, Alloc, Dispatch>::merge_chains(listelem*& a,
+		listelem* b, Compare& comp)
+	{
+		listelem* merged = nullptr;
+		listelem** link = &merged; // where the next node goes
+		listelem* left = a;
+		try
+		{
+			while (left != nullptr && b != nullptr)
+			{
+				if (comp(b->data, left->data))
+				{
+					*link = b;
+					b = b->next;
+				}
+				else
+				{
+					*link = left;
+					left = left->next;
+				}
+				link = &(*link)->next;
+			}
+		}
+		catch (...)
+		{
+			*link = join_chains(left, b);
+			a = merged;
+			throw;
+		}
+		*link = left != nullptr ? left : b;
+		a = merged;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			listelem* List<DataType>::join_chains(listelem* a,
+	//						listelem* b)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Appends the nullptr-terminated chain b to the end of
+	//						chain a.  Either may be nullptr.
+	//	Parameters:		listelem* a- the first chain.
+	//					listelem* b- the chain to append.
+	//	Returns:		The joined chain.
+	//	Calls:			None
+	//	Called by:		sort()
+	//					merge_chains()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	typename List<DataType, Alloc, Dispatch>::listelem*
+		List<DataType, Alloc, Dispatch>::join_chains(listelem* a,
+		listelem* b)
+	{
+		if (a == nullptr)
+			return b;
+		listelem* last = a;
+		while (last->next != nullptr)
+			last = last->next;
+		last->next = b;
+		return a;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::adopt_chain(listelem* first)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Makes the nullptr-terminated chain from first, which
+	//						must hold m_size nodes, the list: sets every
+	//						prev, head and tail, and closes the circle.
+	//	Parameters:		listelem* first- the first node of the chain.
+	//	Returns:		None
+	//	Calls:			invalidate_index()
+	//	Called by:		sort()
+	//					merge()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::adopt_chain(listelem* first)
+	{
+		invalidate_index();
+		listelem* last = first;
+		for (listelem* p = first->next; p != nullptr; p = p->next)
+		{
+			p->prev = last;
+			last = p;
+		}
+		head = first;
+		tail = last;
+		head->prev = tail;
+		tail->next = head;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			listelem* List<DataType>::create_node
+	//						(Args&&... args)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	Allocates a node through the List's allocator and
+	//						constructs its data in place from args.  The
+	//						node is not linked into the list.
+	//	Parameters:		Args&&... args- the arguments for DataType's
+	//						constructor.
+	//	Returns:		A pointer to the new node.
+	//	Calls:			listelem struct constructor
+	//	Called by:		push_front(); push_back();
+	//					emplace_front(); emplace_back();
+	//					push_range(); push_n(); link_copies()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's constructor
+	//						throws.  No memory is leaked either way.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, forwarding
+	//										constructor arguments.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	template <class... Args>
+	typename List<DataType, Alloc, Dispatch>::listelem*
+		List<DataType, Alloc, Dispatch>::
+		create_node(Args&&... args)
+	{
+		listelem* node = node_traits::allocate(m_alloc, 1);
+		try
+		{
+			node_traits::construct(m_alloc, node, nullptr, nullptr,
+				std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(m_alloc, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::destroy_node(listelem* node)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destroys a node and returns its memory to the List's
+	//						allocator.
+	//	Parameters:		listelem* node- the node to free.
+	//	Returns:		None
+	//	Calls:			None
+	//	Called by:		pop_front()
+	//					pop_back()
+	//					pop_n(); destroy_chain()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::destroy_node(listelem* node)
+	{
+		node_traits::destroy(m_alloc, node);
+		node_traits::deallocate(m_alloc, node, 1);
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::destroy_chain(listelem* node)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Destroys and frees every node of an unlinked chain,
+	//						starting at node and following next until it
+	//						reaches nullptr.
+	//	Parameters:		listelem* node- the first node of the chain, or
+	//						nullptr.
+	//	Returns:		None
+	//	Calls:			destroy_node()
+	//	Called by:		push_range(); push_n(); pop_n();
+	//					link_copies(); operator=; release()
+	//	Input:			None
+	//	Output:			None
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::destroy_chain(listelem* node)
+	{
+		while (node != nullptr)
+		{
+			listelem* next = node->next;
+			destroy_node(node);
+			node = next;
+		}
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			void List<DataType>::link_copies
+	//						(const listelem* source, unsigned count)
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Copies count nodes, starting at source and following
+	//						next, onto the back of the list.  The allocator is
+	//						asked to reserve room for all of them first, the
+	//						copies are built into a chain, and the chain is
+	//						linked in with one seam fixup.
+	//	Parameters:		const listelem* source- the first node to copy.  It
+	//						may belong to another list or to this one.
+	//					unsigned count- the number of nodes to copy.
+	//	Returns:		None
+	//	Calls:			reserve_nodes()
+	//					create_node()
+	//					destroy_chain()
+	//					link_range()
+	//	Called by:		Copy constructor
+	//					operator=
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			bad_alloc, or whatever DataType's copy constructor
+	//						throws.  The list is unchanged if it does.
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	void List<DataType, Alloc, Dispatch>::link_copies(const listelem* source,
+		unsigned count)
+	{
+		if (count == 0)
+			return;
+		reserve_nodes(m_alloc, count, 0);
+		listelem* chainFirst = nullptr;
+		listelem* chainLast = nullptr;
+		try
+		{
+			chainFirst = chainLast = create_node(source->data);
+			for (unsigned i = 1; i < count; i++)
+			{
+				source = source->next;
+				listelem* node = create_node(source->data);
+				node->prev = chainLast;
+				chainLast->next = node;
+				chainLast = node;
+			}
+		}
+		catch (...)
+		{
+			destroy_chain(chainFirst);
+			throw;
+		}
+		link_range(nullptr, chainFirst, chainLast, count);
+	}
+
+	//------------------------------------------------------------------------
+	//	Function:		ostream& operator<<
+	//						(ostream& sout, const List<DataType>& x)
+	//	Version			1.1
+	//	Date			10/17/2026
+	//	Description:	prints out a list
+	//	Parameters:		ostream& sout- A reference to the output stream.
+	//					const List<DataType>& x- A reference to the item to be
+	//						printed.
+	//	Returns:		The ostream&
+	//	Calls:			cbegin()
+	//					cend()
+	//	Called by:		None
+	//	Input:			None
+	//	Output:			The data contents of the List.
+	//	Changelog		4/15/2011	PB	completed version 0.8
+	//					4/29/2016	DL	completed version 0.9, adapting it to
+	//										the template class List<DataType>.
+	//					5/13/2016	DL	completed version 1.0.
+	//					10/17/2026	DL	completed version 1.1, walking from
+	//										cbegin() to cend() instead of
+	//										comparing each node with the
+	//										head.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	ostream& operator<<(ostream& sout,
+		const List<DataType, Alloc, Dispatch>& x)
+	{
+		typename List<DataType, Alloc, Dispatch>::const_range_iterator
+			p = x.cbegin(), e = x.cend();
+		sout << "(";
+		if (p != e)
+		{
+			sout << *p;
+			for (++p; p != e; ++p)
+				sout << "," << *p;
+		}
+		sout << ")\n";
+		return sout;
+	}
+
+	//------------------------------------------------------------------------
+	//	Method:			iterator RoundRobinCursor<DataType>::position()
+	//	Version			1.0
+	//	Date			10/17/2026
+	//	Description:	Returns the cursor's node, first moving an unset
+	//						cursor to the head.
+	//	Parameters:		None
+	//	Returns:		An iterator to the current element.
+	//	Calls:			List's empty and begin methods
+	//	Called by:		current(); next(); advance(); erase()
+	//	Input:			None
+	//	Output:			None
+	//	Throws:			runtime_error
+	//	Changelog		10/17/2026	DL	completed version 1.0.
+	//------------------------------------------------------------------------
+	template <class DataType, class Alloc, class Dispatch>
+	typename RoundRobinCursor<DataType, Alloc, Dispatch>::iterator
+		RoundRobinCursor<DataType, Alloc, Dispatch>::position()
+	{
+		if (m_list->empty())
+			throw runtime_error("Could not read cursor: Empty list");
+		if (m_pos == iterator())
+			m_pos = m_list->begin();
+		return m_pos;
+	}
+} // End DL_CDLL namespace.
+
 #endif
\ No newline at end of file